@@ -31,44 +31,20 @@ function MonthName(int m)
 12 -- dec
 */
 #include<iostream>
+#include<string_view>
 
 using namespace std;
 
+// Indexed directly instead of an if-chain; see
+// "Section wise/section7/31.NumberToWords.cpp" for whole numbers.
+constexpr string_view digitWord[10]{
+    "zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine"};
+
 void DigitToWord(int d)
 {
-    if(d==1){
-        std::cout<<"one";
-    }
-    else if(d==2){
-        std::cout<<"two";
-    }
-    else if(d==3){
-        std::cout<<"three";
-    }
-    else if(d==4){
-        std::cout<<"four";
-    }
-    else if(d==5){
-        std::cout<<"five";
-    }
-    else if(d==6){
-        std::cout<<"six";
-    }
-    else if(d==7){
-        std::cout<<"seven";
-    }
-    else if(d==8){
-        std::cout<<"eight";
-    }
-    else if(d==9){
-        std::cout<<"nine";
-    }
-    else if(d==0){
-        std::cout<<"zero";
-    }
-    else{
+    if(d<0 || d>9){
         std::cout<<"greater than 9 not programmed.";
-    } 
-    
+        return;
+    }
+    std::cout<<digitWord[d];
 }
-
@@ -6,17 +6,39 @@ output
 cout<<fact
 */
 #include<iostream>
+#include<vector>
+#include<cstdio>
 
+/*
+int overflows at 13!, so keep the product as "limbs" of 9 decimal digits,
+least significant first: 13! = 6227020800 is stored as {227020800, 6}.
+For 10^5! and beyond see Section wise/section7/28.BigFactorial.cpp.
+*/
 void Factorial(int n)
 {
-    int fact=1;
+    const unsigned long long base{1000000000};
+    std::vector<unsigned long long> fact{1};
     
     //write a loop for finding factorial on n
-    for(int i{1};i<=n;++i)
+    for(int i{2};i<=n;++i)
     {
-        fact*=i;
+        unsigned long long carry{};
+        for(unsigned long long& limb:fact){
+            unsigned long long cur{limb*i+carry};
+            limb=cur%base;
+            carry=cur/base;
+        }
+        while(carry>0){
+            fact.push_back(carry%base);
+            carry/=base;
+        }
     }
     
-    std::cout<<fact;
+    std::cout<<fact.back();
+    for(int k=fact.size()-2;k>=0;--k){
+        char digits[10];
+        std::snprintf(digits, sizeof(digits), "%09llu", fact[k]);
+        std::cout<<digits;
+    }
     
 }
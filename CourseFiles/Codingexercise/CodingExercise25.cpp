@@ -7,17 +7,46 @@ cout<<i<<" "
 */
 
 #include<iostream>
+#include<vector>
+#include<algorithm>
 
 using namespace std;
 
+/*
+Testing every i up to n is O(n).
+Instead find the prime factorization n = p1^e1 * p2^e2 * ... (only needs
+divisors up to sqrt(n)) and build every divisor as a product of those powers.
+For 64-bit n see Section wise/section7/24.PollardRhoFactorization.cpp.
+*/
 void Factors(int n)
 {
-    
-   for(int i{1}; i<=n; ++i)
-   {
-       if(n%i==0){
-           std::cout<<i<<" ";
-       }
-   }
-   
+    vector<int> divisors;
+    if(n>=1){
+        divisors.push_back(1);
+    }
+    int m{n};
+    //divide p out of m; every power of p times each divisor so far is a divisor
+    auto divideOut=[&](int p){
+        int previous=divisors.size();
+        int power{1};
+        while(m%p==0){
+            m/=p;
+            power*=p;
+            for(int i{};i<previous;++i){
+                divisors.push_back(divisors[i]*power);
+            }
+        }
+    };
+    for(int p{2};1LL*p*p<=m;++p){
+        divideOut(p);
+    }
+    if(m>1){
+        divideOut(m);   //whatever is left is a prime
+    }
+    sort(divisors.begin(), divisors.end());
+
+    for(int d:divisors)
+    {
+        std::cout<<d<<" ";
+    }
 }
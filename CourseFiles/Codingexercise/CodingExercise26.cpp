@@ -10,27 +10,42 @@ cout<<"not perfect"
 
 #include<iostream>
 
+/*
+sigma(n) (sum of all factors) is multiplicative:
+if n = p1^e1 * p2^e2 * ... then sigma(n) = (1+p1+..+p1^e1) * (1+p2+..+p2^e2) * ...
+so only divisors up to sqrt(n) need to be tried instead of all n.
+For whole ranges see Section wise/section7/25.DivisorSumSieve.cpp.
+*/
 void Perfect(int n)
 {
-    int sum=0;
-    int i{1};
-    
-    while(i<=n){
-        if (n%i==0){
-            sum+=i;
+    long long sum=(n>=1) ? 1 : 0;
+    int m{n};
+
+    for(int p{2};m>1;++p){
+        if(1LL*p*p>m){
+            p=m;    //whatever is left is a prime
         }
-        ++i;
-    /*
-    Your code took too long to execute.
-    Review the logic in your code might cause it and try again.
-    
-    this error comes in Udemy or online compilers when you forget to add ++i at this point it may happen due to any other reason to but i am writing wrt this line only now.
+        long long power{1};
+        long long term{1};
+        while(m%p==0){
+            m/=p;
+            power*=p;
+            term+=power;
+        }
+        sum*=term;
     }
-    */
-    if(sum==2*n){
+    
+    if(n>=1 && sum==2LL*n){
         std::cout<<"perfect";
     }
     else{
         std::cout<<"not perfect";
     }
 }
+/*
+Your code took too long to execute.
+Review the logic in your code might cause it and try again.
+
+this error comes in Udemy or online compilers when you forget to add ++i in the while loop
+(while(i<=n){ if(n%i==0){ sum+=i; } ++i; }) it may happen due to any other reason to but i am writing wrt that line only now.
+*/
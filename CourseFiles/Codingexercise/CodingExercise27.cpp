@@ -10,21 +10,103 @@ cout<<"not prime"
 */
 
 #include<iostream>
+#include<vector>
+#include<climits>
 
 using namespace std;
 
-void Prime(int n)
+/*
+Counting every factor from 1 to n is O(n) per call.
+A number n is prime if no prime p <= sqrt(n) divides it, so sieve the primes
+up to sqrt(INT_MAX)=46341 once and only try those (at most 4792 divisions).
+See Section wise/section7/22.SegmentedSievePrimes.cpp for the full engine.
+*/
+const vector<int>& SmallPrimes()
+{
+    static const vector<int> primes=[]{
+        const int limit{46341};
+        vector<bool> composite(limit+1, false);
+        vector<int> result;
+        for(int i{2};i<=limit;++i){
+            if(!composite[i]){
+                result.push_back(i);
+                for(long long j{1LL*i*i};j<=limit;j+=i){
+                    composite[j]=true;
+                }
+            }
+        }
+        return result;
+    }();
+    return primes;
+}
+
+/*
+Above INT_MAX the table would need primes up to 3*10^9, so use deterministic
+Miller-Rabin instead (exact for every 64-bit n with these 7 bases).
+See Section wise/section7/23.MillerRabinPrimality.cpp for the Montgomery version.
+*/
+unsigned long long MulMod(unsigned long long a, unsigned long long b, unsigned long long m)
+{
+    return static_cast<unsigned long long>(static_cast<unsigned __int128>(a)*b%m);
+}
+
+unsigned long long PowMod(unsigned long long a, unsigned long long e, unsigned long long m)
+{
+    unsigned long long result{1};
+    a%=m;
+    while(e>0){
+        if(e&1){
+            result=MulMod(result, a, m);
+        }
+        a=MulMod(a, a, m);
+        e>>=1;
+    }
+    return result;
+}
+
+bool MillerRabin(unsigned long long n)
+{
+    unsigned long long d{n-1};
+    int s{};
+    while(d%2==0){
+        d/=2;
+        ++s;
+    }
+    for(unsigned long long a:{2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL}){
+        unsigned long long x{PowMod(a, d, n)};
+        if(a%n==0 || x==1 || x==n-1){
+            continue;
+        }
+        bool witness{true};
+        for(int r{1};r<s && witness;++r){
+            x=MulMod(x, x, n);
+            witness=(x!=n-1);
+        }
+        if(witness){
+            return false;
+        }
+    }
+    return true;
+}
+
+void Prime(long long n)
 {
-    int count=0;
-    int i{1};
-    
-    while(i<=n){
-        if(n%i==0){
-            ++count;
+    bool prime{n>=2};
+    bool useMillerRabin{n>INT_MAX};
+
+    //small primes act as a pre-filter for big n, and decide everything else
+    for(int p:SmallPrimes()){
+        if(!prime || 1LL*p*p>n || (useMillerRabin && p>61)){
+            break;
         }
-        ++i;
-    } 
-    if(count==2){
+        if(n%p==0){
+            prime=false;
+        }
+    }
+    if(prime && useMillerRabin){
+        prime=MillerRabin(static_cast<unsigned long long>(n));
+    }
+    if(prime){
         std::cout<<"prime";
     }
     else{
@@ -9,6 +9,9 @@ cout<<"not a armstrong"
 */
 #include<iostream>
 
+//cubes of the digits 0-9, worked out at compile time instead of calling pow() per digit
+constexpr int cube[10]={0*0*0, 1*1*1, 2*2*2, 3*3*3, 4*4*4, 5*5*5, 6*6*6, 7*7*7, 8*8*8, 9*9*9};
+
 void Armstrong(int n)
 {
     int sum=0,r;
@@ -18,7 +21,7 @@ void Armstrong(int n)
     while(n>0){
         r=n%10;
         n/=10;
-        sum+=std::pow(r,3);
+        sum+=cube[r];
     }
     
      if(sum==m)
@@ -26,3 +29,8 @@ void Armstrong(int n)
     else
         std::cout<<"not armstrong";
 }
+/*
+For the general rule (power = number of digits) and for listing every
+Armstrong number up to 39 digits see
+Section wise/section7/26.ArmstrongNumberEnumerator.cpp
+*/
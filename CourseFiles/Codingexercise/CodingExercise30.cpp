@@ -6,17 +6,29 @@ output
 cout<<rev
 */
 #include<iostream>
+#include<array>
+
+// rev4[c] = the 4 digits of c (with leading zeros) reversed, e.g. 1200 -> 21.
+// One lookup handles 4 digits; see "Section wise/section7/30.DigitReversalTable.cpp".
+static const std::array<int, 10000> rev4=[]{
+    std::array<int, 10000> t{};
+    for(int c=0;c<10000;++c){
+        t[c]=c%10*1000+c/10%10*100+c/100%10*10+c/1000;
+    }
+    return t;
+}();
 
 void Reverse(int n)
 {
-    int rev=0;
-    int m=n;
-    int r;
+    long long rev=0;    // the reverse of a 10-digit int can exceed INT_MAX
     
-   while(n>0){
-       r=n%10;
+   while(n>=10000){
+       rev=rev*10000+rev4[n%10000];
+       n/=10000;
+   }
+   while(n>0){          // at most 3 leading digits left
+       rev=rev*10+n%10;
        n/=10;
-       rev=rev*10+r;
    }
    std::cout<<rev;
 }
@@ -8,19 +8,32 @@ cout<<"palindrome";
 cout<<"not a palindrome";
 */
 #include<iostream>
+#include<array>
 using namespace std;
 
+// rev4[c] = the 4 digits of c (with leading zeros) reversed, e.g. 1200 -> 21.
+// One lookup handles 4 digits; see "Section wise/section7/30.DigitReversalTable.cpp".
+static const array<int, 10000> rev4=[]{
+    array<int, 10000> t{};
+    for(int c=0;c<10000;++c){
+        t[c]=c%10*1000+c/10%10*100+c/100%10*10+c/1000;
+    }
+    return t;
+}();
+
 void Palindrome(int n)
 {
-    int rev=0;
-    int r;
+    long long rev=0;    // the reverse of a 10-digit int can exceed INT_MAX
     int m=n;
     
+    while(n>=10000){
+       rev=rev*10000+rev4[n%10000];
+       n/=10000;
+    }
     while(n>0){
-       r=n%10;
+       rev=rev*10+n%10;
        n/=10;
-       rev=rev*10+r;
-   }
+    }
     
     if(rev==m){
         std::cout<<"palindrome";
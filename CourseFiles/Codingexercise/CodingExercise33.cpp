@@ -14,7 +14,8 @@ using namespace std;
 void Sum()
 {
     int A[]={2,4,11,8,10,15,13},n=7;
-    int sum=0;
+    long long sum=0;    //wider than int, so long arrays cannot overflow it
+                        //(see "Section wise/section8/32.StableSumAverage.cpp")
     
     //add all elements from Array A to sum
     //print sum
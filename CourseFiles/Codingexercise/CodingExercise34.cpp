@@ -4,6 +4,7 @@ Find and display Maximum element from Array
 */
 
 #include<iostream>
+#include<algorithm>
 using namespace std;
 
 void Max()
@@ -12,10 +13,10 @@ void Max()
     int max=A[0];
     
     //write a loop to find max
+    //std::max has no branch (it becomes a max/cmov instruction), so the loop
+    //can be vectorised; see "Section wise/section8/31.MinMaxReduction.cpp"
     for(int x:A){
-        if(x>max){
-            max=x;
-        }
+        max=std::max(max,x);
     }
     cout<<max;
 }
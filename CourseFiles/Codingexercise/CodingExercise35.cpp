@@ -3,6 +3,7 @@ Find Minimum Element in an Array
 Write a loop to find the minimum element from Array
 */
 #include<iostream>
+#include<algorithm>
 using namespace std;
 
 void Min()
@@ -11,10 +12,10 @@ void Min()
     int min=A[0];
     
     //write a loop to find minimum number
-    for(int i{};i<10;++i){
-        if(min>A[i]){
-            min=A[i];
-        }
+    //std::min has no branch (it becomes a min/cmov instruction), so the loop
+    //can be vectorised; see "Section wise/section8/31.MinMaxReduction.cpp"
+    for(int i{1};i<10;++i){
+        min=std::min(min,A[i]);
     }
     
     cout<<min;
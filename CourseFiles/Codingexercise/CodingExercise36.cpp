@@ -13,12 +13,11 @@ void Count()
     int ncount=0;
     
     // write a loop to count positive and negative numbers
+    // (no if: the comparison is 0 or 1, see section8/33.SignCountPartition.cpp)
     for(int x:A)
     {
-        if(x<0)
-            ncount++;
-        else
-            pcount++;
+        ncount+=(x<0);
+        pcount+=(x>=0);
     }
     
     cout<<pcount<<" "<<ncount;
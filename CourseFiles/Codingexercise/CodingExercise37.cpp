@@ -10,16 +10,20 @@ Draw a pattern of * for given dimensions given below
 */
 
 #include<iostream>
+#include<string>
 using namespace std;
 
 void Draw(int n)
 {
-    
+    string out;     // exactly n rows of 2n+1 characters, printed once at the end
+    if(n>0) out.reserve(static_cast<size_t>(n)*(2*n+1));
+
     //Draw Pattern given in description for n x n dimensions
     for(int i{};i<n;++i){
         for(int j{};j<n;++j){
-            cout<<"* ";
+            out+="* ";
         }
-        cout<<endl;
+        out+='\n';
     }
+    cout<<out<<flush;
 }
@@ -9,23 +9,24 @@ Draw a pattern of * for given dimensions given below
         *
 */
 #include<iostream>
+#include<string>
 using namespace std;
 
 void Draw(int n)
 {
-    
+    string out;     // blanks included: one cout for the whole triangle
+
     //Draw Pattern given in description for n x n dimensions
     for(int i{};i<n;++i){
         for(int j{};j<n;++j){
             if(j>=i){
-                cout<<"*"<<" ";
+                out+="* ";
             }
             else{
-                cout<<"  ";
+                out+="  ";
             }
         }
-        cout<<endl;
+        out+='\n';
     }
-
-    
+    cout<<out<<flush;
 }
@@ -9,20 +9,22 @@ Draw a pattern of * for given dimensions given below
 *
 */
 #include<iostream>
+#include<string>
 using namespace std;
 
 void Draw(int n)
 {
-    
+    string out;     // see section8/38.BufferedPatternRenderer.cpp
+
     //Draw Pattern given in description for n x n dimensions
     for(int i{};i<n;++i){
         for(int j{};j<n;++j){
             if(i+j<=n-1){
-                cout<<"* ";
+                out+="* ";
             }
-        
         }
-        cout<<endl;
+        out+='\n';
     }
+    cout<<out<<flush;
 }
 
@@ -9,16 +9,23 @@ using namespace std;
 
 
 //write a pow() function here 
+//square-and-multiply: m^13 = m^8 * m^4 * m^1, so only O(log n) multiplications
+//(see Section wise/section7/29.FastExponentiation.cpp)
 int pow(int m,int n){
     int p{1};
-    for(int i{};i<n;++i){
-        p=p*m;
+    while(n>0){
+        if(n%2==1){
+            p=p*m;
+        }
+        n=n/2;
+        if(n>0){
+            m=m*m;
+        }
     }
     return p;
 }
 
-void main()
+int main()
 {
     cout<<pow(2,5);
 }
-
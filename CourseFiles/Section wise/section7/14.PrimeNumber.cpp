@@ -25,3 +25,7 @@ int main(){
     }
 
 }
+/*
+⚠️ This loop tries every i from 1 to n, so it is O(n) for a single number.
+For many numbers (or big ones) see 22.SegmentedSievePrimes.cpp.
+*/
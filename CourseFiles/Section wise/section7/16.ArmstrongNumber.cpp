@@ -19,7 +19,22 @@ Armstrong <==> d_1^n + d_2^n +.......+ d_n^n = number
 */
 
 #include <iostream>
-#include <cmath>
+
+// digit^digits with integers: std::pow works on double and can round
+// (see 29.FastExponentiation.cpp)
+int power(int base, int exp){
+    int result{1};
+    while(exp>0){
+        if(exp%2==1){
+            result*=base;
+        }
+        exp/=2;
+        if(exp>0){
+            base*=base;     //skip the last square, it is never used and could overflow
+        }
+    }
+    return result;
+}
 
 int main(){
     int num{};
@@ -39,7 +54,7 @@ int main(){
     temp=num;
     while(temp!=0){
         int digit=temp%10;
-        sum+=std::pow(digit,digits);
+        sum+=power(digit,digits);
         temp/=10;
     }
     if(sum==num){
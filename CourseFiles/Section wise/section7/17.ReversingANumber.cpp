@@ -18,3 +18,7 @@ int main(){
     }
     std::cout<<"Reverse of "<< n<<" is "<<rev<<".\n";
 }
+/*
+⚠️ One %10 and one /10 per digit. 30.DigitReversalTable.cpp reverses 4 digits
+per step with a 10000-entry table.
+*/
@@ -23,3 +23,7 @@ int main(){
         std::cout<<"Entered number is not a palindrome."<<std::endl;
     }
 }
+/*
+⚠️ For checking many numbers at once see palindrome_filter() in
+30.DigitReversalTable.cpp.
+*/
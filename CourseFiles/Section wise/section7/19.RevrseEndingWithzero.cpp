@@ -61,7 +61,7 @@ Reverse a number
 
 int main(){
     int n{};
-    char rev[10];
+    char rev[11];       // an int has up to 10 digits, plus '\0'
     int i{};
     int r{};
 
@@ -77,3 +77,7 @@ int main(){
     rev[i]='\0';
     std::cout<<rev<<std::endl;
 }
+/*
+⚡ reverse_to_chars() in 30.DigitReversalTable.cpp keeps the zeros too,
+4 characters at a time.
+*/
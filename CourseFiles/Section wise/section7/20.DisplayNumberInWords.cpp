@@ -3,7 +3,7 @@
 
 int main(){
     int n{};
-    char rev[10];
+    char rev[11];       // an int has up to 10 digits, plus '\0'
     int i{};
     int r{};
 
@@ -57,3 +57,8 @@ int main(){
     }
     
 }
+/*
+⚠️ One std::cout<< per word and a switch per digit. 31.NumberToWords.cpp uses
+constexpr word tables, also spells out full English ("one thousand two
+hundred"), and prints the whole line with a single write.
+*/
@@ -19,3 +19,8 @@ int main(){
     std::cout<<"GCD of "<<m<<" and "<<n<<" is "<< tempm<<"\n";
     return 0;
 }
+/*
+⚠️ Repeated subtraction needs max(m,n)/min(m,n) steps: gcd(10^9, 1) is a
+billion loop iterations, and gcd(m, 0) never stops.
+See 27.BinaryGCD.cpp for Stein's binary GCD, LCM and modular inverse.
+*/
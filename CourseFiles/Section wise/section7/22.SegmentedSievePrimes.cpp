@@ -0,0 +1,240 @@
+/*
+🔢 Segmented Sieve of Eratosthenes
+14.PrimeNumber.cpp decides primality by counting every divisor from 1 to n.
+That is O(n) for ONE number, so classifying millions of numbers is hopeless.
+
+🔹 Idea of the Sieve
+Instead of asking "is n prime?" again and again, cross out the multiples of
+every prime p <= sqrt(limit). Whatever is left uncrossed is prime.
+
+🔹 Why "segmented"?
+A plain sieve up to 10^10 needs 10^10 flags (~1.25 GB even as bits).
+A segmented sieve only keeps:
+ - the base primes up to sqrt(limit)   (for 10^10 that is just 9592 primes)
+ - ONE small segment at a time          (sized to fit in the L1/L2 cache)
+and slides that segment over [lo, hi].
+
+🔹 Tricks used here
+ 1. Odd-only  : even numbers (except 2) are never prime, so bit i of a
+                segment stands for the odd number segLo + 2*i.
+ 2. Bit-packed: 64 odd numbers per std::uint64_t word.
+ 3. Cache-sized segment: 32 KB of bits = 262144 odd numbers = one L1d cache,
+    so every crossing-out hits the cache instead of main memory.
+ 4. Counting uses std::popcount on whole words instead of testing bits.
+
+✅ Complexity
+Old loop   : O(n) per query, O(n^2) to count primes up to n
+Sieve      : O(n log log n) total for the whole range
+*/
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <bit>
+#include <chrono>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+
+class PrimeSieve{
+public:
+    // Segment size in bytes; 32 KB matches a typical L1d, 256 KB a typical L2.
+    static constexpr std::size_t kDefaultSegmentBytes{32*1024};
+
+    explicit PrimeSieve(std::uint64_t limit, std::size_t segmentBytes=kDefaultSegmentBytes)
+        : limit{limit}, segmentBits{std::max<std::size_t>(segmentBytes, 64)/64*64*8}
+    {
+        sqrtLimit=static_cast<std::uint64_t>(std::sqrt(static_cast<long double>(limit)));
+        while(sqrtLimit*sqrtLimit>limit) --sqrtLimit;
+        while((sqrtLimit+1)*(sqrtLimit+1)<=limit) ++sqrtLimit;
+
+        // small byte sieve for the base primes <= sqrt(limit)
+        small.assign(sqrtLimit+1, true);
+        small[0]=false;
+        if(sqrtLimit>=1) small[1]=false;
+        for(std::uint64_t i{2}; i*i<=sqrtLimit; ++i){
+            if(small[i]){
+                for(std::uint64_t j{i*i}; j<=sqrtLimit; j+=i) small[j]=false;
+            }
+        }
+        for(std::uint64_t i{3}; i<=sqrtLimit; i+=2){
+            if(small[i]) basePrimes.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+
+    std::uint64_t max_value() const { return limit; }
+
+    bool is_prime(std::uint64_t n) const
+    {
+        checkRange(n);
+        if(n<=sqrtLimit) return small[n];
+        if(n%2==0) return n==2;
+        for(std::uint32_t p : basePrimes){
+            if(static_cast<std::uint64_t>(p)*p>n) break;
+            if(n%p==0) return false;
+        }
+        return true;
+    }
+
+    // All primes in [lo, hi], in increasing order.
+    std::vector<std::uint64_t> primes_in_range(std::uint64_t lo, std::uint64_t hi) const
+    {
+        checkRange(hi);
+        std::vector<std::uint64_t> result;
+        if(lo>hi) return result;
+        if(lo<=2 && hi>=2) result.push_back(2);
+        forEachSegment(lo, hi, [&](std::uint64_t segLo, const std::uint64_t* bits, std::size_t nbits){
+            for(std::size_t w{0}; w*64<nbits; ++w){
+                std::uint64_t word{bits[w]};
+                while(word){
+                    int b{std::countr_zero(word)};
+                    result.push_back(segLo+2*(w*64+b));
+                    word&=word-1;
+                }
+            }
+        });
+        return result;
+    }
+
+    // Number of primes <= n.
+    std::uint64_t prime_count(std::uint64_t n) const
+    {
+        checkRange(n);
+        if(n<2) return 0;
+        std::uint64_t count{1};     // the prime 2
+        forEachSegment(3, n, [&](std::uint64_t, const std::uint64_t* bits, std::size_t nbits){
+            for(std::size_t w{0}; w*64<nbits; ++w){
+                count+=std::popcount(bits[w]);
+            }
+        });
+        return count;
+    }
+
+private:
+    void checkRange(std::uint64_t n) const
+    {
+        if(n>limit) throw std::out_of_range("PrimeSieve: value above sieve limit");
+    }
+
+    // Calls f(segLo, bits, nbits) for each segment covering the odd numbers
+    // of [lo, hi]; bit i set <=> segLo+2*i is prime. Bits past nbits are 0.
+    template <typename F>
+    void forEachSegment(std::uint64_t lo, std::uint64_t hi, F&& f) const
+    {
+        if(lo<3) lo=3;
+        if(lo%2==0) ++lo;
+        if(lo>hi) return;
+
+        std::vector<std::uint64_t> bits(segmentBits/64);
+        const std::uint64_t span{2*static_cast<std::uint64_t>(segmentBits)};
+
+        for(std::uint64_t segLo{lo}; segLo<=hi; segLo+=span){
+            std::uint64_t segHi{hi-segLo<span ? hi : segLo+span-1};
+            std::size_t nbits{static_cast<std::size_t>((segHi-segLo)/2+1)};
+            std::size_t nwords{(nbits+63)/64};
+
+            std::fill(bits.begin(), bits.begin()+nwords, ~0ULL);
+            if(nbits%64) bits[nwords-1]&=(1ULL<<(nbits%64))-1;
+
+            for(std::uint32_t p : basePrimes){
+                std::uint64_t pp{static_cast<std::uint64_t>(p)*p};
+                if(pp>segHi) break;
+                std::uint64_t start{pp>=segLo ? pp : (segLo+p-1)/p*p};
+                if(start%2==0) start+=p;     // first ODD multiple
+                // consecutive odd multiples are 2p apart = p bits apart
+                for(std::uint64_t j{(start-segLo)/2}; j<nbits; j+=p){
+                    bits[j>>6]&=~(1ULL<<(j&63));
+                }
+            }
+            f(segLo, bits.data(), nbits);
+            if(segHi==hi) break;
+        }
+    }
+
+    std::uint64_t limit{};
+    std::uint64_t sqrtLimit{};
+    std::size_t segmentBits{};
+    std::vector<bool> small;                 // primality of 0..sqrtLimit
+    std::vector<std::uint32_t> basePrimes;   // odd primes <= sqrtLimit
+};
+
+// Same output as Codingexercise/CodingExercise27.cpp, now answered by the sieve.
+void Prime(int n)
+{
+    static const PrimeSieve sieve{static_cast<std::uint64_t>(INT_MAX)};
+    if(n>=0 && sieve.is_prime(static_cast<std::uint64_t>(n))){
+        std::cout<<"prime";
+    }
+    else{
+        std::cout<<"not prime";
+    }
+}
+
+// The counting loop from 14.PrimeNumber.cpp, kept for the benchmark.
+bool isPrimeLoop(int n)
+{
+    int factorcount{0};
+    for(int i{1};i<=n;++i){
+        if(n%i==0) ++factorcount;
+    }
+    return factorcount==2;
+}
+
+int main(){
+    long long n{};
+    std::cout<<"Enter no.:"<<std::flush;
+    std::cin>>n;
+
+    const PrimeSieve sieve{10'000'000'000ULL};
+    if(n>=0 && static_cast<std::uint64_t>(n)<=sieve.max_value()){
+        std::cout<<n<<(sieve.is_prime(n) ? " is a Prime number.\n" : " is not a Prime number.\n");
+    }
+    else{
+        std::cout<<n<<" is outside the sieve range.\n";
+    }
+
+    std::cout<<"Primes between 10^10-100 and 10^10: ";
+    for(std::uint64_t p : sieve.primes_in_range(10'000'000'000ULL-100, 10'000'000'000ULL)){
+        std::cout<<p<<" ";
+    }
+    std::cout<<"\n";
+
+    // Benchmark: count primes <= N with the old loop vs the sieve
+    using Clock=std::chrono::steady_clock;
+    const int N{20'000};
+
+    auto t0{Clock::now()};
+    int loopCount{};
+    for(int i{1};i<=N;++i){
+        if(isPrimeLoop(i)) ++loopCount;
+    }
+    auto t1{Clock::now()};
+    std::uint64_t sieveCount{sieve.prime_count(N)};
+    auto t2{Clock::now()};
+
+    std::chrono::duration<double, std::milli> loopMs{t1-t0};
+    std::chrono::duration<double, std::milli> sieveMs{t2-t1};
+    std::cout<<"pi("<<N<<"): loop="<<loopCount<<" ("<<loopMs.count()<<" ms), "
+             <<"sieve="<<sieveCount<<" ("<<sieveMs.count()<<" ms)\n";
+
+    auto t3{Clock::now()};
+    std::uint64_t big{sieve.prime_count(1'000'000'000ULL)};
+    auto t4{Clock::now()};
+    std::chrono::duration<double, std::milli> bigMs{t4-t3};
+    std::cout<<"pi(10^9) = "<<big<<" ("<<bigMs.count()<<" ms)\n";
+    return 0;
+}
+/*
+🔸 Output (sample)
+Enter no.:9999999967
+9999999967 is a Prime number.
+Primes between 10^10-100 and 10^10: 9999999929 9999999943 9999999967
+pi(20000): loop=2262, sieve=2262
+pi(10^9) = 50847534
+
+⚠️ Notes
+ - prime_count(10^10) = 455052511 also works, it just takes ~10x longer than 10^9.
+ - Values above the limit passed to the constructor throw std::out_of_range.
+ - Pick segmentBytes = L2 size (e.g. 256*1024) on machines with a small L1.
+*/
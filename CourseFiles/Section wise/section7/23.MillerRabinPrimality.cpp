@@ -0,0 +1,421 @@
+/*
+🔢 Deterministic primality for 64-bit numbers (BPSW)
+22.SegmentedSievePrimes.cpp is great for ranges, but for ONE 18-digit number
+the sieve would need all primes up to 10^9. Miller-Rabin base 2 plus a Lucas
+test answers in ~0.3 us for a typical (composite) number and ~0.85 us for a
+prime on a 2 GHz machine.
+
+🔹 Idea
+Write n-1 = d * 2^s with d odd. For a prime n and any base a:
+    a^d ≡ 1 (mod n)   or   a^(d*2^r) ≡ -1 (mod n) for some 0 <= r < s
+If a base a breaks this, n is definitely composite ("a is a witness").
+The 7 bases {2, 325, 9375, 28178, 450775, 9780504, 1795265022} catch every
+composite below 2^64, but a PRIME has to run all 7 exponentiations.
+
+🔹 Baillie-PSW: base 2 + extra strong Lucas
+Composites that fool base 2 (2047, 3215031751 ...) are rare, and a Lucas
+test fails on them for an unrelated reason. With the smallest P = 3, 4, ...
+for which D = P^2-4 has Jacobi symbol (D/n) = -1, the sequence
+    V_0 = 2, V_1 = P, V_(k+1) = P*V_k - V_(k-1)
+satisfies, for a prime n and n+1 = d * 2^s (d odd):
+    U_d ≡ 0 and V_d ≡ ±2 (mod n),  or  V_(d*2^r) ≡ 0 for some 0 <= r < s-1
+V_2k = V_k^2 - 2 and V_(2k+1) = V_k*V_(k+1) - P give V_d in 2 multiplications
+per bit; U_d ≡ 0 is checked as 2*V_(d+1) ≡ P*V_d. No composite below 2^64
+passes both tests (checked against the complete list of base-2 strong
+pseudoprimes), so one MR exponentiation plus one Lucas chain (~3 MR bases'
+worth of work) replaces all 7 bases, and the answer is still exact.
+bpsw() runs both chains in the same loop: they are independent, so the CPU
+overlaps them and a prime costs about one chain's latency.
+
+🔹 Montgomery multiplication
+a*b % n with 64-bit n needs a 128-bit product and a slow 128-bit division.
+Montgomery form stores x as x*R mod n (R = 2^64). Then
+    reduce(t) = t * R^-1 mod n
+needs only multiplications and a shift, no division at all.
+unsigned __int128 (GCC/Clang) holds the 128-bit intermediates.
+
+🔹 Small-prime pre-filter
+Most random numbers have a small factor; dividing by the primes below 64
+rejects ~80% of odd candidates before any exponentiation.
+
+🔹 Batched API
+is_prime_batch() runs the base-2 exponentiations of 4 candidates in
+lockstep, so the CPU can overlap the multiplications of different candidates
+(instruction-level parallelism) instead of waiting on one long dependency
+chain. The few survivors then get the Lucas test.
+*/
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <bit>
+#include <chrono>
+#include <random>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+
+using u64=std::uint64_t;
+using u128=unsigned __int128;
+
+// Arithmetic modulo an odd n in Montgomery form (R = 2^64).
+struct Montgomery64{
+    u64 n{};
+    u64 nInv{};     // n * nInv ≡ 1 (mod 2^64)
+    u64 r2{};       // R^2 mod n
+    u64 one{};      // R mod n, i.e. 1 in Montgomery form
+
+    explicit Montgomery64(u64 mod) : n{mod}
+    {
+        nInv=n;                         // correct to 3 bits for odd n
+        for(int i{};i<5;++i){
+            nInv*=2-n*nInv;             // Newton step doubles the correct bits
+        }
+        one=(0-n)%n;
+        r2=static_cast<u64>(static_cast<u128>(one)*one%n);
+    }
+
+    u64 reduce(u128 t) const
+    {
+        u64 m{static_cast<u64>(t)*nInv};
+        u64 hi{static_cast<u64>(t>>64)};
+        u64 mnHi{static_cast<u64>((static_cast<u128>(m)*n)>>64)};
+        return hi>=mnHi ? hi-mnHi : hi-mnHi+n;
+    }
+
+    u64 mul(u64 a, u64 b) const { return reduce(static_cast<u128>(a)*b); }
+    u64 to(u64 a) const { return mul(a%n, r2); }
+
+    u64 add(u64 a, u64 b) const { return a>=n-b ? a-(n-b) : a+b; }
+    u64 sub(u64 a, u64 b) const { return a>=b ? a-b : a-b+n; }
+
+    u64 pow(u64 a, u64 e) const
+    {
+        u64 result{one};
+        while(e){
+            if(e&1) result=mul(result, a);
+            a=mul(a, a);
+            e>>=1;
+        }
+        return result;
+    }
+};
+
+constexpr u64 kBase2[]{2};
+constexpr unsigned kSmallPrimes[]{2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61};
+
+// 0 = composite, 1 = prime, 2 = survived the filter, needs Miller-Rabin
+int smallPrimeFilter(u64 n)
+{
+    if(n<2) return 0;
+    for(unsigned p : kSmallPrimes){
+        if(n%p==0) return n==p ? 1 : 0;
+    }
+    return n<67*67 ? 1 : 2;
+}
+
+// Jacobi symbol (a/n) for odd n > 0.
+int jacobi(u64 a, u64 n)
+{
+    a%=n;
+    int result{1};
+    while(a!=0){
+        const int twos{std::countr_zero(a)};
+        a>>=twos;
+        if((twos&1) && (n%8==3 || n%8==5)) result=-result;
+        if(a%4==3 && n%4==3) result=-result;
+        std::swap(a, n);
+        a%=n;
+    }
+    return n==1 ? result : 0;
+}
+
+bool isSquare(u64 n)
+{
+    u64 r{static_cast<u64>(std::sqrt(static_cast<double>(n)))};
+    while(static_cast<u128>(r)*r>n) --r;
+    while(static_cast<u128>(r+1)*(r+1)<=n) ++r;
+    return r*r==n;
+}
+
+// Lucas sequence V_k (Q = 1) in Montgomery form, stepped one bit of the
+// index at a time from the top: (V_k, V_(k+1)) → (V_2k, V_(2k+1)) or
+// (V_(2k+1), V_(2k+2)). The two multiplications of a step are independent,
+// and the bit only selects operands (masks, no branch to mispredict).
+struct LucasChain{
+    u64 p, two;             // P and 2 in Montgomery form
+    u64 v, vNext;           // V_k, V_(k+1), starting at k = 0
+
+    LucasChain(const Montgomery64& mont, u64 parameter)
+        : p{mont.to(parameter)}, two{mont.to(2)}, v{two}, vNext{p} {}
+
+    void step(const Montgomery64& mont, u64 bit)
+    {
+        const u64 mask{0-bit};                          // all ones when bit is 1
+        const u64 squared{(vNext&mask)|(v&~mask)};
+        const u64 cross{mont.sub(mont.mul(v, vNext), p)};
+        const u64 doubled{mont.sub(mont.mul(squared, squared), two)};
+        v=(cross&mask)|(doubled&~mask);
+        vNext=(doubled&mask)|(cross&~mask);
+    }
+
+    // Called with k = d, where n+1 = d * 2^s.
+    bool accepts(const Montgomery64& mont, int s)
+    {
+        if((v==two || v==mont.n-two) && mont.add(vNext, vNext)==mont.mul(p, v)) return true;
+        for(int r{};r<s-1;++r){
+            if(v==0) return true;
+            v=mont.sub(mont.mul(v, v), two);
+        }
+        return false;
+    }
+};
+
+// Smallest P >= 3 with Jacobi((P^2-4)/n) = -1, or 0 when the search itself
+// shows that n (odd, > 67^2) is composite.
+u64 lucasParameter(u64 n)
+{
+    if(isSquare(n)) return 0;           // (D/n) is never -1 for a square
+    for(u64 p{3};;++p){
+        const int j{jacobi(p*p-4, n)};
+        if(j==-1) return p;
+        if(j==0) return 0;              // n shares a factor with p^2-4 < n
+    }
+}
+
+// Extra strong Lucas probable prime test, odd n > 67^2.
+bool extraStrongLucas(u64 n)
+{
+    const u64 parameter{lucasParameter(n)};
+    if(parameter==0) return false;
+    const Montgomery64 mont{n};
+    u64 d{n+1};                         // n < 2^64-1: 2^64-1 is divisible by 3
+    const int s{std::countr_zero(d)};
+    d>>=s;
+    LucasChain lucas{mont, parameter};
+    for(int bit{63-std::countl_zero(d)};bit>=0;--bit) lucas.step(mont, (d>>bit)&1);
+    return lucas.accepts(mont, s);
+}
+
+// Base-2 Miller-Rabin and the extra strong Lucas test, exact for every
+// n < 2^64 (odd, > 67^2: what the small-prime filter leaves). The two
+// chains do not depend on each other, so they run in ONE loop and the
+// CPU overlaps their multiplications.
+bool bpsw(u64 n)
+{
+    const u64 parameter{lucasParameter(n)};
+    if(parameter==0) return false;
+    const Montgomery64 mont{n};
+    u64 dm{n-1}, dl{n+1};
+    const int sm{std::countr_zero(dm)}, sl{std::countr_zero(dl)};
+    dm>>=sm;
+    dl>>=sl;
+
+    // 2^dm left to right: multiplying by 2 is an addition, so only the
+    // squarings are Montgomery multiplications
+    u64 x{mont.one};
+    LucasChain lucas{mont, parameter};
+    const int bitsM{64-std::countl_zero(dm)}, bitsL{64-std::countl_zero(dl)};
+    for(int bit{std::max(bitsM, bitsL)-1};bit>=0;--bit){
+        if(bit<bitsM){
+            x=mont.mul(x, x);
+            x=mont.add(x, x&(0-((dm>>bit)&1)));         // x or 2x, without a branch
+        }
+        if(bit<bitsL) lucas.step(mont, (dl>>bit)&1);
+    }
+
+    const u64 minusOne{n-mont.one};
+    bool strong{x==mont.one || x==minusOne};
+    for(int r{1};r<sm && !strong;++r){
+        x=mont.mul(x, x);
+        strong=x==minusOne;
+    }
+    return strong && lucas.accepts(mont, sl);
+}
+
+bool is_prime(u64 n)
+{
+    int filtered{smallPrimeFilter(n)};
+    return filtered==2 ? bpsw(n) : filtered==1;
+}
+
+// Miller-Rabin with the given bases on 4 odd candidates at once; the lanes
+// are independent, so their Montgomery multiplications can run in parallel.
+void millerRabin4(const u64 (&n)[4], bool (&out)[4], const u64* bases, int baseCount)
+{
+    const Montgomery64 mont[4]{Montgomery64{n[0]}, Montgomery64{n[1]}, Montgomery64{n[2]}, Montgomery64{n[3]}};
+    u64 d[4]{}, minusOne[4]{};
+    int s[4]{};
+    int maxBits{};
+    for(int k{};k<4;++k){
+        out[k]=true;
+        minusOne[k]=n[k]-mont[k].one;
+        s[k]=std::countr_zero(n[k]-1);
+        d[k]=(n[k]-1)>>s[k];
+        maxBits=std::max(maxBits, 64-std::countl_zero(d[k]));
+    }
+
+    for(int b{};b<baseCount;++b){
+        const u64 a{bases[b]};
+        if(!(out[0] || out[1] || out[2] || out[3])) break;
+        // fixed 4-bit window: table[k][w] = a^w, then 4 squarings + 1 lookup
+        // multiply per window, with no data-dependent branches
+        u64 table[4][16]{};
+        u64 base[4]{}, x[4]{};
+        for(int k{};k<4;++k){
+            base[k]=mont[k].to(a);
+            table[k][0]=mont[k].one;
+            table[k][1]=base[k];
+        }
+        for(int w{2};w<16;++w){
+            for(int k{};k<4;++k){
+                table[k][w]=mont[k].mul(table[k][w-1], base[k]);
+            }
+        }
+        int top{(maxBits+3)/4*4};
+        for(int k{};k<4;++k){
+            x[k]=table[k][(d[k]>>(top-4))&15];
+        }
+        for(int shift{top-8};shift>=0;shift-=4){
+            for(int sq{};sq<4;++sq){
+                for(int k{};k<4;++k){
+                    x[k]=mont[k].mul(x[k], x[k]);
+                }
+            }
+            for(int k{};k<4;++k){
+                x[k]=mont[k].mul(x[k], table[k][(d[k]>>shift)&15]);
+            }
+        }
+        for(int k{};k<4;++k){
+            if(!out[k] || base[k]==0) continue;
+            if(x[k]==mont[k].one || x[k]==minusOne[k]) continue;
+            bool witness{true};
+            for(int r{1};r<s[k];++r){
+                x[k]=mont[k].mul(x[k], x[k]);
+                if(x[k]==minusOne[k]){
+                    witness=false;
+                    break;
+                }
+            }
+            if(witness) out[k]=false;
+        }
+    }
+}
+
+// Runs millerRabin4 over in[idx[0..]] in groups of 4 and returns the
+// indices that survived every base.
+std::vector<std::size_t> millerRabinGroups(const u64* in, const std::vector<std::size_t>& idx,
+                                           const u64* bases, int baseCount)
+{
+    std::vector<std::size_t> survivors;
+    for(std::size_t g{};g<idx.size();g+=4){
+        std::size_t used{std::min<std::size_t>(4, idx.size()-g)};
+        u64 group[4]{};
+        bool result[4]{};
+        for(std::size_t k{};k<4;++k){
+            group[k]=in[idx[g+(k<used ? k : 0)]];     // pad with a real candidate
+        }
+        millerRabin4(group, result, bases, baseCount);
+        for(std::size_t k{};k<used;++k){
+            if(result[k]) survivors.push_back(idx[g+k]);
+        }
+    }
+    return survivors;
+}
+
+// out[i] = is_prime(in[i]) for i in [0, count).
+// Pass 1 runs base 2 on 4 lanes at a time, which rejects nearly every
+// composite; pass 2 runs the Lucas test on the (almost all prime) survivors.
+void is_prime_batch(const u64* in, bool* out, std::size_t count)
+{
+    std::vector<std::size_t> pending;
+    for(std::size_t i{};i<count;++i){
+        int filtered{smallPrimeFilter(in[i])};
+        out[i]=filtered==1;
+        if(filtered==2) pending.push_back(i);
+    }
+    pending=millerRabinGroups(in, pending, kBase2, 1);
+    for(std::size_t i : pending){
+        out[i]=extraStrongLucas(in[i]);
+    }
+}
+
+// Same output as Codingexercise/CodingExercise27.cpp, now for 64-bit input.
+void Prime(u64 n)
+{
+    if(is_prime(n)){
+        std::cout<<"prime";
+    }
+    else{
+        std::cout<<"not prime";
+    }
+}
+
+int main(){
+    u64 n{};
+    std::cout<<"Enter no.:"<<std::flush;
+    std::cin>>n;
+    std::cout<<n<<(is_prime(n) ? " is a Prime number.\n" : " is not a Prime number.\n");
+
+    // Benchmark on random 18-digit odd numbers
+    using Clock=std::chrono::steady_clock;
+    std::mt19937_64 rng{2024};
+    std::uniform_int_distribution<u64> dist{100'000'000'000'000'000ULL, 999'999'999'999'999'999ULL};
+    const std::size_t count{1'000'000};
+    std::vector<u64> candidates(count);
+    for(u64& c : candidates) c=dist(rng)|1;
+
+    auto t0{Clock::now()};
+    std::size_t singlePrimes{};
+    for(u64 c : candidates){
+        if(is_prime(c)) ++singlePrimes;
+    }
+    auto t1{Clock::now()};
+    std::unique_ptr<bool[]> flags{new bool[count]};
+    is_prime_batch(candidates.data(), flags.get(), count);
+    auto t2{Clock::now()};
+    std::size_t batchPrimes{};
+    for(std::size_t i{};i<count;++i) batchPrimes+=flags[i];
+
+    std::chrono::duration<double, std::nano> singleNs{t1-t0};
+    std::chrono::duration<double, std::nano> batchNs{t2-t1};
+    std::cout<<"single: "<<singlePrimes<<" primes, "<<singleNs.count()/count<<" ns/query\n";
+    std::cout<<"batch : "<<batchPrimes<<" primes, "<<batchNs.count()/count<<" ns/query\n";
+
+    // Worst case: actual primes run the whole Miller-Rabin round and Lucas chain
+    std::vector<u64> primes;
+    for(u64 c : candidates){
+        if(primes.size()==10'000) break;
+        if(is_prime(c)) primes.push_back(c);
+    }
+    auto t3{Clock::now()};
+    std::size_t check{};
+    for(u64 p : primes) check+=is_prime(p);
+    auto t4{Clock::now()};
+    std::chrono::duration<double, std::nano> primeNs{t4-t3};
+    std::cout<<"18-digit primes: "<<primeNs.count()/primes.size()<<" ns/query ("<<check<<" confirmed)\n";
+    return 0;
+}
+/*
+🔸 Output (sample, 2 GHz Xeon, g++ -O2)
+Enter no.:999999999999999989
+999999999999999989 is a Prime number.
+single: 49414 primes, ~290 ns/query
+batch : 49414 primes, ~180 ns/query
+18-digit primes: ~850 ns/query
+
+⚠️ Notes
+ - With all 7 Miller-Rabin bases one after another a prime took ~2500 ns
+   here. Base 2 + Lucas is ~3x less work, and running the two chains in one
+   loop with branchless bit steps overlaps them.
+ - ~850 ns is a 2 GHz VM, and it varies (up to ~1.2 us) with the machine's
+   load: the cost is a chain of ~60 dependent Montgomery multiplications,
+   so it scales with the clock speed.
+ - Every query now pays for the Jacobi search (~70 ns) and the Lucas chain
+   runs alongside Miller-Rabin, so a composite that base 2 already rejects
+   costs a little more than before (~290 vs ~230 ns on average).
+ - Montgomery form needs an odd modulus; even n never reach bpsw()
+   because the pre-filter rejects them.
+ - Strong pseudoprimes like 3215031751 (fools bases 2,3,5,7) pass the
+   base-2 round and are rejected by the Lucas test.
+*/
@@ -0,0 +1,313 @@
+/*
+🔢 Prime factorization with Pollard-rho (Brent)
+10.FactorsOfaNumber_ForLoop.cpp tests every i from 1 to n, which is O(n).
+Every divisor of n is a product of its prime factors, so it is enough to
+find the prime factorization
+    n = p1^e1 * p2^e2 * ... * pk^ek
+and build the divisor list from it.
+
+🔹 Step 1: trial division by a small prime table
+Sieve the primes below 1024 once. Dividing them out removes all the small
+factors that make up most of a "random" number.
+
+🔹 Step 2: Pollard-rho (Brent's variant)
+For what is left, walk the sequence x -> x^2 + c (mod n). Modulo a hidden
+prime factor p this sequence must repeat after about sqrt(p) steps, and then
+gcd(|x - y|, n) reveals p. Since p <= sqrt(n), finding it takes about
+n^(1/4) steps instead of n.
+Brent's tricks:
+ - multiply 128 differences together and take ONE gcd for all of them
+ - if the batched gcd overshoots to n, replay the last batch one step at a time
+
+🔹 Step 3: Miller-Rabin
+Decides when a leftover number is already prime (see 23.MillerRabinPrimality.cpp).
+All modular multiplications use Montgomery form, no 128-bit division.
+
+🔹 Step 4: divisors
+Number of divisors = (e1+1)(e2+1)...(ek+1), generated by multiplying
+every divisor found so far by p, p^2, ..., p^e.
+*/
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <bit>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+#include <utility>
+
+using u64=std::uint64_t;
+using u128=unsigned __int128;
+
+// Arithmetic modulo an odd n in Montgomery form (R = 2^64), as in 23.MillerRabinPrimality.cpp.
+struct Montgomery64{
+    u64 n{};
+    u64 nInv{};
+    u64 r2{};
+    u64 one{};
+
+    explicit Montgomery64(u64 mod) : n{mod}
+    {
+        nInv=n;
+        for(int i{};i<5;++i){
+            nInv*=2-n*nInv;
+        }
+        one=(0-n)%n;
+        r2=static_cast<u64>(static_cast<u128>(one)*one%n);
+    }
+
+    u64 reduce(u128 t) const
+    {
+        u64 m{static_cast<u64>(t)*nInv};
+        u64 hi{static_cast<u64>(t>>64)};
+        u64 mnHi{static_cast<u64>((static_cast<u128>(m)*n)>>64)};
+        return hi>=mnHi ? hi-mnHi : hi-mnHi+n;
+    }
+
+    u64 mul(u64 a, u64 b) const { return reduce(static_cast<u128>(a)*b); }
+    u64 to(u64 a) const { return mul(a%n, r2); }
+    u64 add(u64 a, u64 b) const { return a>=n-b ? a-(n-b) : a+b; }
+
+    u64 pow(u64 a, u64 e) const
+    {
+        u64 result{one};
+        while(e){
+            if(e&1) result=mul(result, a);
+            a=mul(a, a);
+            e>>=1;
+        }
+        return result;
+    }
+};
+
+// n must be odd and > 1
+bool millerRabin(u64 n)
+{
+    const Montgomery64 mont{n};
+    const u64 minusOne{n-mont.one};
+    u64 d{n-1};
+    int s{std::countr_zero(d)};
+    d>>=s;
+
+    for(u64 a : {2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL}){
+        u64 x{mont.to(a)};
+        if(x==0) continue;
+        x=mont.pow(x, d);
+        if(x==mont.one || x==minusOne) continue;
+        bool witness{true};
+        for(int r{1};r<s && witness;++r){
+            x=mont.mul(x, x);
+            witness=(x!=minusOne);
+        }
+        if(witness) return false;
+    }
+    return true;
+}
+
+const std::vector<std::uint32_t>& smallPrimes()
+{
+    static const std::vector<std::uint32_t> primes=[]{
+        const std::uint32_t limit{1024};
+        std::vector<bool> composite(limit, false);
+        std::vector<std::uint32_t> result;
+        for(std::uint32_t i{2};i<limit;++i){
+            if(composite[i]) continue;
+            result.push_back(i);
+            for(std::uint32_t j{i*i};j<limit;j+=i) composite[j]=true;
+        }
+        return result;
+    }();
+    return primes;
+}
+
+// Returns a non-trivial factor of an odd composite n.
+u64 pollardBrent(u64 n)
+{
+    const Montgomery64 mont{n};
+    const int batch{128};
+    auto diff=[](u64 a, u64 b){ return a>b ? a-b : b-a; };
+
+    for(u64 c{1};;++c){
+        const u64 cm{mont.to(c)};
+        auto f=[&](u64 v){ return mont.add(mont.mul(v, v), cm); };
+
+        u64 x{}, y{mont.to(2)}, ys{}, q{mont.one}, g{1};
+        for(u64 r{1}; g==1; r*=2){
+            x=y;
+            for(u64 i{};i<r;++i) y=f(y);
+            for(u64 k{}; k<r && g==1; k+=batch){
+                ys=y;
+                for(u64 i{}; i<batch && i<r-k; ++i){
+                    y=f(y);
+                    q=mont.mul(q, diff(x, y));
+                }
+                g=std::gcd(q, n);
+            }
+        }
+        if(g==n){
+            // the batch overshot: replay it one gcd at a time
+            do{
+                ys=f(ys);
+                g=std::gcd(diff(x, ys), n);
+            }while(g==1);
+        }
+        if(g!=n) return g;
+        // the cycle closed without splitting n, try another constant c
+    }
+}
+
+void collectFactors(u64 n, std::vector<u64>& primes)
+{
+    if(n==1) return;
+    if(millerRabin(n)){
+        primes.push_back(n);
+        return;
+    }
+    u64 d{pollardBrent(n)};
+    collectFactors(d, primes);
+    collectFactors(n/d, primes);
+}
+
+// Prime factorization as sorted (prime, exponent) pairs. factorize(1) is
+// empty; 0 has no factorization, and factorize(0) is empty too.
+std::vector<std::pair<u64, int>> factorize(u64 n)
+{
+    std::vector<u64> primes;
+    for(std::uint32_t p : smallPrimes()){
+        if(static_cast<u64>(p)*p>n) break;
+        while(n%p==0){
+            primes.push_back(p);
+            n/=p;
+        }
+    }
+    if(n>1){
+        const u64 tableEnd{smallPrimes().back()};
+        if(n<=tableEnd*tableEnd){
+            primes.push_back(n);        // no factor <= sqrt(n) left, so n is prime
+        }
+        else{
+            collectFactors(n, primes);
+        }
+    }
+    std::sort(primes.begin(), primes.end());
+
+    std::vector<std::pair<u64, int>> result;
+    for(u64 p : primes){
+        if(!result.empty() && result.back().first==p){
+            ++result.back().second;
+        }
+        else{
+            result.push_back({p, 1});
+        }
+    }
+    return result;
+}
+
+// All divisors of the number with this factorization, in increasing order.
+std::vector<u64> divisors(const std::vector<std::pair<u64, int>>& factors)
+{
+    std::size_t total{1};
+    for(const auto& [p, e] : factors) total*=e+1;
+
+    std::vector<u64> result;
+    result.reserve(total);
+    result.push_back(1);
+    for(const auto& [p, e] : factors){
+        std::size_t previous{result.size()};
+        u64 power{1};
+        for(int k{1};k<=e;++k){
+            power*=p;
+            for(std::size_t i{};i<previous;++i){
+                result.push_back(result[i]*power);
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+// Same output as Codingexercise/CodingExercise25.cpp, built from the factorization.
+void Factors(u64 n)
+{
+    if(n==0) return;        // the exercise prints nothing for n <= 0
+    for(u64 d : divisors(factorize(n))){
+        std::cout<<d<<" ";
+    }
+}
+
+// The loop from 10.FactorsOfaNumber_ForLoop.cpp, kept for the benchmark.
+std::size_t countFactorsLoop(u64 n)
+{
+    std::size_t factorcount{};
+    for(u64 i{1};i<=n;++i){
+        if(n%i==0) ++factorcount;
+    }
+    return factorcount;
+}
+
+int main(){
+    u64 n{};
+    std::cout<<"Enter no.:"<<std::flush;
+    std::cin>>n;
+    if(n==0){
+        std::cout<<"Every number is a factor of 0.\n";
+        return 0;
+    }
+
+    std::cout<<n<<" =";
+    for(const auto& [p, e] : factorize(n)){
+        std::cout<<" "<<p<<"^"<<e;
+    }
+    std::cout<<"\n";
+    int factorcount{1};
+    for(u64 d : divisors(factorize(n))){
+        std::cout<<"Factor "<<factorcount<<" ="<<d<<"\n";
+        ++factorcount;
+    }
+
+    // Benchmark: the O(n) loop vs factorize + divisors
+    using Clock=std::chrono::steady_clock;
+    const u64 m{73'513'440};           // 768 divisors
+
+    auto t0{Clock::now()};
+    std::size_t loopCount{countFactorsLoop(m)};
+    auto t1{Clock::now()};
+    std::size_t fastCount{divisors(factorize(m)).size()};
+    auto t2{Clock::now()};
+    std::chrono::duration<double, std::micro> loopUs{t1-t0};
+    std::chrono::duration<double, std::micro> fastUs{t2-t1};
+    std::cout<<"divisors of "<<m<<": loop="<<loopCount<<" ("<<loopUs.count()<<" us), "
+             <<"pollard="<<fastCount<<" ("<<fastUs.count()<<" us)\n";
+
+    // 18-digit semiprimes are far beyond any loop
+    const u64 semiprimes[]{1'000'000'016'000'000'063ULL, 999'999'866'000'004'473ULL, 4'611'686'014'132'420'609ULL};
+    for(u64 s : semiprimes){
+        auto t3{Clock::now()};
+        auto f{factorize(s)};
+        auto t4{Clock::now()};
+        std::chrono::duration<double, std::micro> us{t4-t3};
+        std::cout<<s<<" =";
+        for(const auto& [p, e] : f) std::cout<<" "<<p<<"^"<<e;
+        std::cout<<" ("<<us.count()<<" us)\n";
+    }
+    return 0;
+}
+/*
+🔸 Output (sample)
+Enter no.:360
+360 = 2^3 3^2 5^1
+Factor 1 =1
+Factor 2 =2
+...
+Factor 24 =360
+1000000016000000063 = 1000000007^1 1000000009^1
+999999866000004473 = 999999929^1 999999937^1
+4611686014132420609 = 2147483647^2
+
+⚠️ Notes
+ - Pollard-rho is randomized in spirit: a bad constant c can close the cycle
+   without splitting n, so pollardBrent() just retries with c+1.
+ - Worst case inputs are products of two primes near 2^32, which need about
+   2^16 sequence steps.
+*/
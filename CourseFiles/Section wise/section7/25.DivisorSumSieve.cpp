@@ -0,0 +1,202 @@
+/*
+🔢 Divisor sums for a whole range: sigma(n) sieve
+12.SumOfFactorsOfaNumber.cpp and 13.PerfectNumber.cpp compute
+    sigma(n) = sum of all divisors of n
+with an O(n) loop for one n. Classifying every n <= N that way is O(N^2).
+
+🔹 Classification (with s = sigma(n) - n, the sum of PROPER divisors)
+ - s <  n  → deficient  (e.g. 8: 1+2+4 = 7)
+ - s == n  → perfect    (e.g. 28: 1+2+4+7+14 = 28)
+ - s >  n  → abundant   (e.g. 12: 1+2+3+4+6 = 16)
+
+🔹 sigma is multiplicative
+If n = p1^e1 * ... * pk^ek then sigma(n) = sigma(p1^e1) * ... * sigma(pk^ek),
+and sigma(p^e) = 1 + p + ... + p^e.
+
+🔹 Linear sieve: sigma_table(N) in O(N)
+Every composite n is produced exactly once as n = i*p with p = smallest prime
+factor of n. Then:
+ - p does not divide i :  sigma(i*p) = sigma(i) * (1+p)
+ - p divides i         :  sigma(i*p) = (p+1)*sigma(i) - p*sigma(i/p)
+The second rule means no extra "power of p" array is needed, only the
+uint64 sigma table itself plus the list of primes.
+
+🔹 Segmented: sigma_segmented(N, block, f)
+For N = 10^9 a full table is 8 GB. The segmented version handles one block
+of numbers at a time (like 22.SegmentedSievePrimes.cpp):
+ - rem[n] starts as n, sig[n] as 1
+ - for each prime p <= sqrt(N), divide the powers of p out of its multiples
+   and multiply sig by 1+p+...+p^e
+ - whatever is left in rem (> 1) is one big prime q: multiply by 1+q
+Memory is O(block + sqrt(N)) no matter how large N is.
+*/
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+
+using u64=std::uint64_t;
+
+// sigma[n] for 0 <= n <= N (sigma[0] = 0).
+std::vector<u64> sigma_table(u64 N)
+{
+    std::vector<u64> sigma(N+1, 0);
+    std::vector<std::uint32_t> primes;
+    if(N>=1) sigma[1]=1;
+
+    for(u64 i{2};i<=N;++i){
+        if(sigma[i]==0){                 // never produced as i = j*p, so prime
+            sigma[i]=i+1;
+            primes.push_back(static_cast<std::uint32_t>(i));
+        }
+        for(std::uint32_t p : primes){
+            u64 n{i*p};
+            if(n>N) break;
+            if(i%p==0){
+                sigma[n]=(p+1)*sigma[i]-p*sigma[i/p];
+                break;                   // p is the smallest prime of n; stop here
+            }
+            sigma[n]=sigma[i]*(p+1);
+        }
+    }
+    return sigma;
+}
+
+// Calls f(lo, sigma, count) with sigma[k] = sigma(lo+k) for consecutive
+// blocks covering 1..N. Only one block is in memory at a time.
+template <typename F>
+void sigma_segmented(u64 N, u64 block, F&& f)
+{
+    u64 root{static_cast<u64>(std::sqrt(static_cast<long double>(N)))};
+    while(root*root>N) --root;
+    while((root+1)*(root+1)<=N) ++root;
+
+    std::vector<std::uint32_t> primes;
+    {
+        std::vector<bool> composite(root+1, false);
+        for(u64 i{2};i<=root;++i){
+            if(composite[i]) continue;
+            primes.push_back(static_cast<std::uint32_t>(i));
+            for(u64 j{i*i};j<=root;j+=i) composite[j]=true;
+        }
+    }
+
+    std::vector<u64> sig(block), rem(block);
+    for(u64 lo{1};lo<=N;lo+=block){
+        u64 count{std::min(block, N-lo+1)};
+        for(u64 k{};k<count;++k){
+            sig[k]=1;
+            rem[k]=lo+k;
+        }
+        for(std::uint32_t p : primes){
+            u64 first{(lo+p-1)/p*p};
+            for(u64 m{first};m<lo+count;m+=p){
+                u64 k{m-lo};
+                u64 power{1};
+                u64 sum{1};
+                do{
+                    rem[k]/=p;
+                    power*=p;
+                    sum+=power;
+                }while(rem[k]%p==0);
+                sig[k]*=sum;
+            }
+        }
+        for(u64 k{};k<count;++k){
+            if(rem[k]>1) sig[k]*=rem[k]+1;   // the one prime factor > sqrt(N)
+        }
+        f(lo, sig.data(), count);
+    }
+}
+
+struct Classification{
+    u64 deficient{};
+    u64 perfect{};
+    u64 abundant{};
+    std::vector<u64> perfectNumbers;
+
+    void add(u64 n, u64 sigma)
+    {
+        if(sigma<2*n){
+            ++deficient;
+        }
+        else if(sigma==2*n){
+            ++perfect;
+            perfectNumbers.push_back(n);
+        }
+        else{
+            ++abundant;
+        }
+    }
+};
+
+// The loop from 12.SumOfFactorsOfaNumber.cpp (plus n itself), kept for the benchmark.
+u64 sigmaLoop(u64 n)
+{
+    u64 sum{};
+    for(u64 i{1};i<=n;++i){
+        if(n%i==0) sum+=i;
+    }
+    return sum;
+}
+
+int main(){
+    u64 N{};
+    std::cout<<"Classify all numbers up to:"<<std::flush;
+    std::cin>>N;
+
+    using Clock=std::chrono::steady_clock;
+
+    auto t0{Clock::now()};
+    std::vector<u64> sigma{sigma_table(N)};
+    Classification linear;
+    for(u64 n{1};n<=N;++n) linear.add(n, sigma[n]);
+    auto t1{Clock::now()};
+
+    Classification segmented;
+    bool same{true};
+    sigma_segmented(N, 1<<16, [&](u64 lo, const u64* sig, u64 count){
+        for(u64 k{};k<count;++k){
+            segmented.add(lo+k, sig[k]);
+            same=same && sig[k]==sigma[lo+k];
+        }
+    });
+    auto t2{Clock::now()};
+
+    std::cout<<"deficient="<<linear.deficient<<" perfect="<<linear.perfect
+             <<" abundant="<<linear.abundant<<"\nperfect numbers:";
+    for(u64 p : linear.perfectNumbers) std::cout<<" "<<p;
+    std::cout<<"\nsegmented sieve "<<(same ? "agrees" : "DISAGREES")<<" with the linear sieve\n";
+
+    std::chrono::duration<double, std::milli> linearMs{t1-t0};
+    std::chrono::duration<double, std::milli> segmentedMs{t2-t1};
+    std::cout<<"linear sieve: "<<linearMs.count()<<" ms, segmented: "<<segmentedMs.count()<<" ms\n";
+
+    // Benchmark the old O(n) loop on a small prefix, it is O(N^2) overall
+    const u64 small{std::min<u64>(N, 20'000)};
+    auto t3{Clock::now()};
+    u64 mismatches{};
+    for(u64 n{1};n<=small;++n){
+        if(sigmaLoop(n)!=sigma[n]) ++mismatches;
+    }
+    auto t4{Clock::now()};
+    std::chrono::duration<double, std::milli> loopMs{t4-t3};
+    std::cout<<"loop for n <= "<<small<<": "<<loopMs.count()<<" ms ("<<mismatches<<" mismatches)\n";
+    return 0;
+}
+/*
+🔸 Output (sample)
+Classify all numbers up to:10000000
+deficient=7523259 perfect=4 abundant=2476737
+perfect numbers: 6 28 496 8128
+segmented sieve agrees with the linear sieve
+
+⚠️ Notes
+ - sigma(n) is only a small multiple of n (below 6n for n < 10^9), so
+   uint64 is far from overflowing.
+ - For N = 10^9 use sigma_segmented only: its memory is two blocks of
+   uint64 plus the primes up to sqrt(N).
+*/
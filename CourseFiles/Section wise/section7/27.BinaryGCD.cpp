@@ -0,0 +1,258 @@
+/*
+🔢 Binary (Stein's) GCD, LCM and modular inverse
+21.GCD.cpp subtracts the smaller number from the larger one until both are
+equal. gcd(10^9, 1) needs a BILLION subtractions (and gcd(m, 0) never ends).
+
+🔹 Stein's algorithm
+Uses only shifts and subtraction, no division:
+ 1. gcd(a, 0) = a
+ 2. the common factor 2^k of a and b is countr_zero(a | b)
+ 3. remove all factors of 2 from a and b (they are no longer common)
+ 4. both odd: gcd(a, b) = gcd(min, max - min), and max - min is even,
+    so shift its 2s out again
+Each round at least halves the larger number → O(log(max)) rounds.
+std::countr_zero (C++20 <bit>) counts the trailing zero bits in ONE
+instruction (tzcnt/bsf), so step 3 is not a loop.
+Using std::min / std::max instead of if/else lets the compiler use
+conditional moves, no branch mispredictions.
+
+🔹 Extended Euclid
+Also finds x, y with a*x + b*y = gcd(a, b).
+If gcd(a, m) = 1 then a*x ≡ 1 (mod m), so x is the modular inverse of a.
+
+🔹 gcd_reduce
+gcd of a whole array; as soon as the running gcd hits 1 it can never change
+again, so the loop stops early.
+*/
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <bit>
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <numeric>
+#include <random>
+#include <chrono>
+#include <string>
+
+using u64=std::uint64_t;
+using u128=unsigned __int128;
+
+constexpr u64 gcd(u64 a, u64 b)
+{
+    if(a==0) return b;
+    if(b==0) return a;
+    const int shift{std::countr_zero(a|b)};
+    a>>=std::countr_zero(a);
+    do{
+        b>>=std::countr_zero(b);
+        const u64 lo{std::min(a, b)};
+        const u64 hi{std::max(a, b)};
+        a=lo;
+        b=hi-lo;
+    }while(b!=0);
+    return a<<shift;
+}
+
+// std::countr_zero has no overload for unsigned __int128
+constexpr int countr_zero128(u128 x)
+{
+    const u64 low{static_cast<u64>(x)};
+    return low!=0 ? std::countr_zero(low) : 64+std::countr_zero(static_cast<u64>(x>>64));
+}
+
+constexpr u128 gcd(u128 a, u128 b)
+{
+    if(a==0) return b;
+    if(b==0) return a;
+    const int shift{countr_zero128(a|b)};
+    a>>=countr_zero128(a);
+    do{
+        b>>=countr_zero128(b);
+        if((a>>64)==0 && (b>>64)==0){
+            return static_cast<u128>(gcd(static_cast<u64>(a), static_cast<u64>(b)))<<shift;
+        }
+        const u128 lo{std::min(a, b)};
+        const u128 hi{std::max(a, b)};
+        a=lo;
+        b=hi-lo;
+    }while(b!=0);
+    return a<<shift;
+}
+
+// lcm(a, b); lcm with 0 is 0. Throws std::overflow_error if it does not fit.
+constexpr u64 lcm(u64 a, u64 b)
+{
+    if(a==0 || b==0) return 0;
+    u64 result{};
+    if(__builtin_mul_overflow(a/gcd(a, b), b, &result)){
+        throw std::overflow_error("lcm: result does not fit in 64 bits");
+    }
+    return result;
+}
+
+constexpr u128 lcm(u128 a, u128 b)
+{
+    if(a==0 || b==0) return 0;
+    u128 result{};
+    if(__builtin_mul_overflow(a/gcd(a, b), b, &result)){
+        throw std::overflow_error("lcm: result does not fit in 128 bits");
+    }
+    return result;
+}
+
+static_assert(gcd(u64{48}, u64{18})==6);
+static_assert(gcd(u64{0}, u64{7})==7);
+static_assert(lcm(u64{4}, u64{6})==12);
+
+struct ExtendedGcd{
+    u64 g{};
+    __int128 x{};       // a*x + b*y == g
+    __int128 y{};
+};
+
+ExtendedGcd extended_gcd(u64 a, u64 b)
+{
+    __int128 oldR{a}, r{b};
+    __int128 oldX{1}, x{0};
+    __int128 oldY{0}, y{1};
+    while(r!=0){
+        const __int128 q{oldR/r};
+        oldR-=q*r;  std::swap(oldR, r);
+        oldX-=q*x;  std::swap(oldX, x);
+        oldY-=q*y;  std::swap(oldY, y);
+    }
+    return {static_cast<u64>(oldR), oldX, oldY};
+}
+
+// x in [0, m) with a*x ≡ 1 (mod m), or nothing when gcd(a, m) != 1.
+std::optional<u64> mod_inverse(u64 a, u64 m)
+{
+    if(m==0) return std::nullopt;
+    if(m==1) return 0;
+    const ExtendedGcd e{extended_gcd(a%m, m)};
+    if(e.g!=1) return std::nullopt;
+    __int128 x{e.x%static_cast<__int128>(m)};
+    if(x<0) x+=m;
+    return static_cast<u64>(x);
+}
+
+// gcd of every element; stops as soon as the running gcd is 1.
+u64 gcd_reduce(std::span<const u64> values)
+{
+    u64 g{};
+    for(u64 v : values){
+        g=gcd(g, v);
+        if(g==1) break;
+    }
+    return g;
+}
+
+std::string toString(u128 n)
+{
+    if(n==0) return "0";
+    std::string s;
+    while(n>0){
+        s+=static_cast<char>('0'+static_cast<int>(n%10));
+        n/=10;
+    }
+    std::reverse(s.begin(), s.end());
+    return s;
+}
+
+// The loop from 21.GCD.cpp, kept for the benchmark.
+u64 gcdSubtraction(u64 m, u64 n)
+{
+    while(m!=n){
+        if(m>n){
+            m=m-n;
+        }
+        else{
+            n=n-m;
+        }
+    }
+    return m;
+}
+
+int main(){
+    u64 m{};
+    u64 n{};
+    std::cout<<"Enter two no.:"<<std::flush;
+    std::cin>>m>>n;
+    std::cout<<"GCD of "<<m<<" and "<<n<<" is "<<gcd(m, n)<<"\n";
+    try{
+        std::cout<<"LCM of "<<m<<" and "<<n<<" is "<<lcm(m, n)<<"\n";
+    }
+    catch(const std::overflow_error& e){
+        std::cout<<e.what()<<"\n";
+    }
+    if(std::optional<u64> inv{mod_inverse(m, n)}){
+        std::cout<<m<<"^-1 mod "<<n<<" = "<<*inv<<"\n";
+    }
+    else{
+        std::cout<<m<<" has no inverse mod "<<n<<"\n";
+    }
+
+    const u128 big1{static_cast<u128>(1'000'000'007ULL)*1'000'000'009ULL*1'000'000'021ULL};
+    const u128 big2{static_cast<u128>(1'000'000'009ULL)*1'000'000'021ULL*998'244'353ULL};
+    std::cout<<"128-bit gcd = "<<toString(gcd(big1, big2))<<"\n";
+
+    const std::vector<u64> values{360, 840, 1260, 6300, 7, 99, 1000};
+    std::cout<<"gcd_reduce = "<<gcd_reduce(values)<<"\n";
+
+    // Benchmark
+    using Clock=std::chrono::steady_clock;
+    std::mt19937_64 rng{7};
+    std::vector<u64> a(1'000'000), b(1'000'000);
+    for(std::size_t i{};i<a.size();++i){
+        a[i]=rng()>>34;                // 30-bit values keep the subtraction loop bearable
+        b[i]=(rng()>>34)|1;
+    }
+
+    auto t0{Clock::now()};
+    u64 check0{};
+    for(std::size_t i{};i<a.size()/100;++i) check0+=gcdSubtraction(a[i]|1, b[i]);
+    auto t1{Clock::now()};
+    u64 check1{};
+    for(std::size_t i{};i<a.size()/100;++i) check1+=gcd(a[i]|1, b[i]);
+    auto t2{Clock::now()};
+    u64 check2{};
+    for(std::size_t i{};i<a.size();++i) check2+=gcd(a[i], b[i]);
+    auto t3{Clock::now()};
+    u64 check3{};
+    for(std::size_t i{};i<a.size();++i) check3+=std::gcd(a[i], b[i]);
+    auto t4{Clock::now()};
+
+    auto nsPer=[](auto d, std::size_t count){ return std::chrono::duration<double, std::nano>{d}.count()/count; };
+    std::cout<<"subtraction: "<<nsPer(t1-t0, a.size()/100)<<" ns/gcd\n";
+    std::cout<<"binary     : "<<nsPer(t3-t2, a.size())<<" ns/gcd"<<(check0==check1 ? "" : " (MISMATCH)")<<"\n";
+    std::cout<<"std::gcd   : "<<nsPer(t4-t3, a.size())<<" ns/gcd"<<(check2==check3 ? "" : " (MISMATCH)")<<"\n";
+
+    volatile u64 billion{1'000'000'000};     // volatile: stop the compiler from folding the loop
+    volatile u64 one{1};
+    auto t5{Clock::now()};
+    u64 slow{gcdSubtraction(billion, one)};
+    auto t6{Clock::now()};
+    u64 fast{gcd(u64{billion}, u64{one})};
+    auto t7{Clock::now()};
+    std::cout<<"gcd(10^9, 1): subtraction="<<slow<<" ("<<nsPer(t6-t5, 1)/1e6<<" ms), binary="<<fast
+             <<" ("<<nsPer(t7-t6, 1)<<" ns)\n";
+    return 0;
+}
+/*
+🔸 Output (sample)
+Enter two no.:12 18
+GCD of 12 and 18 is 6
+LCM of 12 and 18 is 36
+12 has no inverse mod 18
+128-bit gcd = 1000000030000000189
+gcd_reduce = 1
+
+⚠️ Notes
+ - gcd(0, 0) is 0 and lcm(x, 0) is 0, the usual conventions.
+ - extended_gcd keeps its coefficients in __int128 so they cannot overflow
+   for any pair of 64-bit inputs.
+*/
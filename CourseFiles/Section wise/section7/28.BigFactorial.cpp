@@ -0,0 +1,352 @@
+/*
+🔢 Exact factorials of 100000! and beyond
+8.Factorial_ForLoop.cpp stores n! in unsigned long long, which overflows at
+21!. 10^5! has 456574 digits and 10^6! has 5565709 digits, so we need our own
+big integer type.
+
+🔹 Representation
+A BigUnsigned is a vector of "limbs" in base 10^9, least significant first:
+    123456789012345678  →  { 12345678, 123456789 }   (i.e. 123456789*10^9 + 12345678)
+Base 10^9 means:
+ - a limb fits in 32 bits and limb*limb (< 10^18) fits in 64 bits
+ - printing is just writing each limb as 9 digits: base-10 conversion is
+   O(length) instead of the O(length^2) repeated division a binary base
+   would need
+
+🔹 Karatsuba multiplication
+Schoolbook multiplication of two n-limb numbers is n^2 limb products.
+Split a = a1*B^k + a0 and b = b1*B^k + b0, then
+    a*b = z2*B^2k + z1*B^k + z0
+    z0 = a0*b0,  z2 = a1*b1,  z1 = (a0+a1)*(b0+b1) - z0 - z2
+3 half-size products instead of 4 → O(n^1.585). Below ~64 limbs the
+schoolbook loop is faster, so recursion stops there.
+
+🔹 Product tree (binary splitting)
+1*2*3*...*n one at a time multiplies a HUGE number by a tiny one n times.
+Instead split the range in half, multiply each half recursively, then
+multiply the two results: every level of the tree multiplies numbers of
+similar size, which is exactly where Karatsuba shines.
+
+🔹 Parallel
+The two halves of the tree are independent, and so are the three Karatsuba
+products, so the top levels run on separate threads (std::async).
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <span>
+#include <cstdint>
+#include <algorithm>
+#include <future>
+#include <thread>
+#include <chrono>
+
+class BigUnsigned{
+public:
+    using Limb=std::uint32_t;
+    static constexpr Limb kBase{1'000'000'000};
+    static constexpr int kBaseDigits{9};
+
+    BigUnsigned()=default;
+
+    BigUnsigned(std::uint64_t value)
+    {
+        while(value>0){
+            limbs.push_back(static_cast<Limb>(value%kBase));
+            value/=kBase;
+        }
+    }
+
+    bool isZero() const { return limbs.empty(); }
+
+    // this *= small, for 0 <= small < 2^32
+    void multiplySmall(std::uint32_t small)
+    {
+        std::uint64_t carry{};
+        for(Limb& limb : limbs){
+            std::uint64_t cur{static_cast<std::uint64_t>(limb)*small+carry};
+            limb=static_cast<Limb>(cur%kBase);
+            carry=cur/kBase;
+        }
+        while(carry>0){
+            limbs.push_back(static_cast<Limb>(carry%kBase));
+            carry/=kBase;
+        }
+        trim(limbs);
+    }
+
+    // parallelDepth > 0 lets the top Karatsuba levels use extra threads
+    static BigUnsigned multiply(const BigUnsigned& a, const BigUnsigned& b, int parallelDepth=0)
+    {
+        BigUnsigned result;
+        result.limbs=mul(a.limbs, b.limbs, parallelDepth);
+        return result;
+    }
+
+    friend BigUnsigned operator*(const BigUnsigned& a, const BigUnsigned& b)
+    {
+        return multiply(a, b);
+    }
+
+    std::size_t digitCount() const
+    {
+        if(limbs.empty()) return 1;
+        std::size_t top{1};
+        for(Limb v{limbs.back()}; v>=10; v/=10) ++top;
+        return (limbs.size()-1)*kBaseDigits+top;
+    }
+
+    // Every limb becomes exactly 9 characters, written straight into one string.
+    std::string toString() const
+    {
+        if(limbs.empty()) return "0";
+        std::string s{std::to_string(limbs.back())};
+        std::size_t pos{s.size()};
+        s.resize(pos+(limbs.size()-1)*kBaseDigits);
+        for(std::size_t i{limbs.size()-1}; i-->0;){
+            Limb v{limbs[i]};
+            for(int d{kBaseDigits-1};d>=0;--d){
+                s[pos+d]=static_cast<char>('0'+v%10);
+                v/=10;
+            }
+            pos+=kBaseDigits;
+        }
+        return s;
+    }
+
+private:
+    using Limbs=std::vector<Limb>;
+    static constexpr std::size_t kKaratsubaThreshold{64};
+
+    static void trim(Limbs& x)
+    {
+        while(!x.empty() && x.back()==0) x.pop_back();
+    }
+
+    static Limbs add(std::span<const Limb> a, std::span<const Limb> b)
+    {
+        if(a.size()<b.size()) std::swap(a, b);
+        Limbs result(a.size()+1);
+        Limb carry{};
+        for(std::size_t i{};i<a.size();++i){
+            Limb cur{a[i]+(i<b.size() ? b[i] : 0)+carry};     // < 2*10^9+1 < 2^32
+            carry=cur>=kBase;
+            result[i]=carry ? cur-kBase : cur;
+        }
+        result[a.size()]=carry;
+        trim(result);
+        return result;
+    }
+
+    // acc -= x, requires acc >= x
+    static void subtractInPlace(Limbs& acc, std::span<const Limb> x)
+    {
+        Limb borrow{};
+        for(std::size_t i{};i<acc.size();++i){
+            Limb sub{(i<x.size() ? x[i] : 0)+borrow};
+            if(sub==0 && i>=x.size()) break;
+            borrow=acc[i]<sub;
+            acc[i]=borrow ? acc[i]+kBase-sub : acc[i]-sub;
+        }
+        trim(acc);
+    }
+
+    // acc[offset..] += x, acc must be large enough to hold the result
+    static void addInPlace(Limbs& acc, std::span<const Limb> x, std::size_t offset)
+    {
+        Limb carry{};
+        std::size_t i{};
+        for(;i<x.size() || carry;++i){
+            Limb cur{acc[offset+i]+(i<x.size() ? x[i] : 0)+carry};
+            carry=cur>=kBase;
+            acc[offset+i]=carry ? cur-kBase : cur;
+        }
+    }
+
+    // O(a*b) products; a is the longer operand so the inner loop is long.
+    // Each product is < 10^18, so 16 of them can pile up in a uint64 before
+    // the carries have to be pushed along (16*10^18 < 2^64).
+    static Limbs schoolbook(std::span<const Limb> a, std::span<const Limb> b)
+    {
+        std::vector<std::uint64_t> acc(a.size()+b.size());
+        auto propagate=[&acc]{
+            std::uint64_t carry{};
+            for(std::uint64_t& v : acc){
+                std::uint64_t cur{v+carry};
+                v=cur%kBase;
+                carry=cur/kBase;
+            }
+        };
+        for(std::size_t i{};i<b.size();++i){
+            const std::uint64_t bi{b[i]};
+            std::uint64_t* row{acc.data()+i};
+            for(std::size_t j{};j<a.size();++j){
+                row[j]+=bi*a[j];
+            }
+            if(i%16==15) propagate();
+        }
+        propagate();
+        Limbs result(acc.begin(), acc.end());
+        trim(result);
+        return result;
+    }
+
+    static std::span<const Limb> trimmed(std::span<const Limb> x)
+    {
+        while(!x.empty() && x.back()==0) x=x.first(x.size()-1);
+        return x;
+    }
+
+    static Limbs mul(std::span<const Limb> a, std::span<const Limb> b, int parallelDepth)
+    {
+        a=trimmed(a);
+        b=trimmed(b);
+        if(a.size()<b.size()) std::swap(a, b);
+        if(b.empty()) return {};
+        if(b.size()<kKaratsubaThreshold) return schoolbook(a, b);
+
+        if(a.size()>=2*b.size()){
+            // unbalanced: multiply b by b-sized slices of a
+            Limbs result(a.size()+b.size());
+            for(std::size_t start{};start<a.size();start+=b.size()){
+                std::size_t len{std::min(b.size(), a.size()-start)};
+                addInPlace(result, mul(a.subspan(start, len), b, parallelDepth), start);
+            }
+            trim(result);
+            return result;
+        }
+
+        const std::size_t k{a.size()/2};
+        const auto a0{a.first(k)}, a1{a.subspan(k)};
+        const auto b0{b.first(std::min(k, b.size()))}, b1{b.subspan(std::min(k, b.size()))};
+
+        Limbs z0, z1, z2;
+        if(parallelDepth>0){
+            auto f0{std::async(std::launch::async, [&]{ return mul(a0, b0, parallelDepth-1); })};
+            auto f2{std::async(std::launch::async, [&]{ return mul(a1, b1, parallelDepth-1); })};
+            z1=mul(add(a0, a1), add(b0, b1), parallelDepth-1);
+            z0=f0.get();
+            z2=f2.get();
+        }
+        else{
+            z0=mul(a0, b0, 0);
+            z2=mul(a1, b1, 0);
+            z1=mul(add(a0, a1), add(b0, b1), 0);
+        }
+        subtractInPlace(z1, z0);
+        subtractInPlace(z1, z2);
+
+        Limbs result(a.size()+b.size()+1);
+        addInPlace(result, z0, 0);
+        addInPlace(result, z1, k);
+        addInPlace(result, z2, 2*k);
+        trim(result);
+        return result;
+    }
+
+    Limbs limbs;        // base 10^9, least significant first, no leading zeros
+};
+
+// lo * (lo+1) * ... * hi
+BigUnsigned productRange(std::uint32_t lo, std::uint32_t hi, int parallelDepth)
+{
+    if(lo>hi) return BigUnsigned{1};
+    if(hi-lo<32){
+        BigUnsigned result{1};
+        std::uint64_t packed{1};
+        for(std::uint64_t i{lo};i<=hi;++i){
+            if(packed*i>=(1ULL<<32)){       // multiply several small factors at once
+                result.multiplySmall(static_cast<std::uint32_t>(packed));
+                packed=1;
+            }
+            packed*=i;
+        }
+        result.multiplySmall(static_cast<std::uint32_t>(packed));
+        return result;
+    }
+    const std::uint32_t mid{lo+(hi-lo)/2};
+    if(parallelDepth>0){
+        auto left{std::async(std::launch::async, productRange, lo, mid, parallelDepth-1)};
+        BigUnsigned right{productRange(mid+1, hi, parallelDepth-1)};
+        return BigUnsigned::multiply(left.get(), right, parallelDepth);
+    }
+    return productRange(lo, mid, 0)*productRange(mid+1, hi, 0);
+}
+
+BigUnsigned factorial(std::uint32_t n)
+{
+    unsigned threads{std::max(1u, std::thread::hardware_concurrency())};
+    int depth{};
+    while((1u<<depth)<threads) ++depth;
+    return productRange(2, n, depth);
+}
+
+// The loop from 8.Factorial_ForLoop.cpp on a big number: one factor at a time.
+BigUnsigned factorialLoop(std::uint32_t n)
+{
+    BigUnsigned fact{1};
+    for(std::uint32_t i{2};i<=n;++i){
+        fact.multiplySmall(i);
+    }
+    return fact;
+}
+
+// Same output as Codingexercise/CodingExercise24.cpp, but exact for any n.
+void Factorial(int n)
+{
+    std::cout<<factorial(n>0 ? static_cast<std::uint32_t>(n) : 0).toString();
+}
+
+int main(){
+    int n{};
+    std::cout<<"Enter no. whose factorial is req.:"<<std::flush;
+    std::cin>>n;
+    if(n<0){
+        std::cout<<"Factorial of a negative number is not defined.\n";
+        return 0;
+    }
+
+    using Clock=std::chrono::steady_clock;
+    auto t0{Clock::now()};
+    BigUnsigned fact{factorial(static_cast<std::uint32_t>(n))};
+    auto t1{Clock::now()};
+    std::string text{fact.toString()};
+    auto t2{Clock::now()};
+
+    if(text.size()<=80){
+        std::cout<<n<<"! ="<<text<<"\n";
+    }
+    else{
+        std::cout<<n<<"! ="<<text.substr(0, 30)<<"..."<<text.substr(text.size()-30)
+                 <<" ("<<text.size()<<" digits)\n";
+    }
+    std::chrono::duration<double, std::milli> mulMs{t1-t0};
+    std::chrono::duration<double, std::milli> strMs{t2-t1};
+    std::cout<<"product tree: "<<mulMs.count()<<" ms, to decimal: "<<strMs.count()<<" ms\n";
+
+    // Benchmark against the one-factor-at-a-time loop
+    const std::uint32_t m{20'000};
+    auto t3{Clock::now()};
+    BigUnsigned slow{factorialLoop(m)};
+    auto t4{Clock::now()};
+    BigUnsigned fast{factorial(m)};
+    auto t5{Clock::now()};
+    std::chrono::duration<double, std::milli> loopMs{t4-t3};
+    std::chrono::duration<double, std::milli> treeMs{t5-t4};
+    std::cout<<m<<"!: loop "<<loopMs.count()<<" ms, product tree "<<treeMs.count()<<" ms, "
+             <<(slow.toString()==fast.toString() ? "same" : "DIFFERENT")<<" result\n";
+    return 0;
+}
+/*
+🔸 Output (sample)
+Enter no. whose factorial is req.:100000
+100000! =282422940796034787429342157802...000000000000000000000000000000 (456574 digits)
+
+⚠️ Notes
+ - unsigned long long holds up to 20!, unsigned __int128 up to 34!.
+ - On one 2 GHz core 10^5! takes ~0.4 s and 10^6! ~22 s; with more cores
+   the product tree and top Karatsuba levels split across threads.
+ - Karatsuba is the only fast multiply here; Toom-3 or FFT multiplication
+   would pay off further for n around 10^6 and above.
+*/
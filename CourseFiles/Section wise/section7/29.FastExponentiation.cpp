@@ -0,0 +1,329 @@
+/*
+🔢 Fast exponentiation: ipow, modpow and batched modpow
+Codingexercise/CodingExercise45.cpp computes m^n with n multiplications, and
+16.ArmstrongNumber.cpp calls the floating point std::pow for integer digits.
+
+🔹 Square-and-multiply
+Write the exponent in binary, e.g. 13 = 1101b, so
+    m^13 = m^8 * m^4 * m^1
+Squaring m gives m^2, m^4, m^8, ... so only log2(n) squarings plus one
+multiply per 1-bit are needed: O(log n) instead of O(n).
+
+🔹 ipow (checked)
+m^n overflows 64 bits very quickly (2^64, 3^41, 10^20). ipow() checks every
+multiplication with __builtin_mul_overflow and throws std::overflow_error
+instead of silently wrapping around like the int loop.
+
+🔹 modpow for 64-bit moduli
+(a*b) % m with 64-bit m needs a 128-bit product and a slow 128-bit division.
+ - odd m  : Montgomery form (see 23.MillerRabinPrimality.cpp), no division
+ - even m : split m = 2^k * q with q odd. Mod 2^k is just masking bits,
+            mod q is Montgomery, and the Chinese Remainder Theorem glues the
+            two answers back together.
+
+🔹 constexpr
+ipow and modpow are constexpr, so tables like d^k for 16.ArmstrongNumber.cpp
+can be built at compile time.
+
+🔹 Batched modpow
+Many bases, one exponent, one modulus (e.g. hashing, Fermat tests):
+ - modulus < 2^31: 32-bit Montgomery on 8 lanes at a time; every step is a
+   32x32->64 multiply, which the compiler turns into SIMD (vpmuludq)
+ - larger moduli : 4 interleaved 64-bit Montgomery chains for ILP
+*/
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <array>
+#include <cstdint>
+#include <bit>
+#include <stdexcept>
+#include <chrono>
+#include <random>
+
+using u32=std::uint32_t;
+using u64=std::uint64_t;
+using u128=unsigned __int128;
+
+// base^exp, throws std::overflow_error if the result does not fit in 64 bits.
+constexpr u64 ipow(u64 base, unsigned exp)
+{
+    u64 result{1};
+    while(true){
+        if(exp&1){
+            if(__builtin_mul_overflow(result, base, &result)){
+                throw std::overflow_error("ipow: result does not fit in 64 bits");
+            }
+        }
+        exp>>=1;
+        if(exp==0) break;
+        if(__builtin_mul_overflow(base, base, &base)){
+            throw std::overflow_error("ipow: result does not fit in 64 bits");
+        }
+    }
+    return result;
+}
+
+// Arithmetic modulo an odd n in Montgomery form (R = 2^64).
+struct Montgomery64{
+    u64 n{};
+    u64 nInv{};
+    u64 r2{};
+    u64 one{};
+
+    constexpr explicit Montgomery64(u64 mod) : n{mod}
+    {
+        nInv=n;
+        for(int i{};i<5;++i){
+            nInv*=2-n*nInv;
+        }
+        one=(0-n)%n;
+        r2=static_cast<u64>(static_cast<u128>(one)*one%n);
+    }
+
+    constexpr u64 reduce(u128 t) const
+    {
+        u64 m{static_cast<u64>(t)*nInv};
+        u64 hi{static_cast<u64>(t>>64)};
+        u64 mnHi{static_cast<u64>((static_cast<u128>(m)*n)>>64)};
+        return hi>=mnHi ? hi-mnHi : hi-mnHi+n;
+    }
+
+    constexpr u64 mul(u64 a, u64 b) const { return reduce(static_cast<u128>(a)*b); }
+    constexpr u64 to(u64 a) const { return mul(a%n, r2); }
+    constexpr u64 from(u64 a) const { return reduce(a); }
+
+    constexpr u64 pow(u64 a, u64 e) const
+    {
+        u64 result{one};
+        while(e){
+            if(e&1) result=mul(result, a);
+            a=mul(a, a);
+            e>>=1;
+        }
+        return result;
+    }
+};
+
+// Montgomery with R = 2^32 for odd moduli below 2^31. Every operation is on
+// 64-bit integers holding 32-bit values, which vectorises.
+struct Montgomery32{
+    u32 n{};
+    u32 negInv{};   // n * negInv ≡ -1 (mod 2^32)
+    u32 r2{};
+    u32 one{};
+
+    constexpr explicit Montgomery32(u32 mod) : n{mod}
+    {
+        u32 inv{n};
+        for(int i{};i<4;++i){
+            inv*=2-n*inv;
+        }
+        negInv=0-inv;
+        one=static_cast<u32>((u64{1}<<32)%n);
+        r2=static_cast<u32>(static_cast<u64>(one)*one%n);
+    }
+
+    constexpr u64 reduce(u64 t) const
+    {
+        u64 m{static_cast<u32>(t*negInv)};
+        u64 r{(t+m*n)>>32};     // t, m*n < n*2^32, so the sum fits in 64 bits only for n < 2^31
+        return r>=n ? r-n : r;
+    }
+
+    constexpr u64 mul(u64 a, u64 b) const { return reduce(a*b); }
+};
+
+// x^-1 mod 2^k for odd x (Newton iteration, correct to all 64 bits)
+constexpr u64 inverseMod2k(u64 x)
+{
+    u64 inv{x};
+    for(int i{};i<5;++i){
+        inv*=2-x*inv;
+    }
+    return inv;
+}
+
+// base^exp mod m for any m >= 1.
+constexpr u64 modpow(u64 base, u64 exp, u64 m)
+{
+    if(m==1) return 0;
+    const int k{std::countr_zero(m)};
+    const u64 q{m>>k};
+
+    // mod q (odd) with Montgomery
+    u64 rq{0};
+    if(q>1){
+        const Montgomery64 mont{q};
+        rq=mont.from(mont.pow(mont.to(base), exp));
+    }
+    if(k==0) return rq;
+
+    // mod 2^k: plain 64-bit arithmetic wraps mod 2^64, then mask
+    const u64 mask{k==64 ? ~u64{0} : (u64{1}<<k)-1};
+    u64 r2k{1};
+    u64 b{base};
+    for(u64 e{exp}; e; e>>=1){
+        if(e&1) r2k*=b;
+        b*=b;
+    }
+    r2k&=mask;
+    if(q==1) return r2k;
+
+    // CRT: x = rq + q*t with t ≡ (r2k - rq) * q^-1 (mod 2^k)
+    const u64 t{((r2k-rq)*inverseMod2k(q))&mask};
+    return rq+q*t;          // < q*2^k = m
+}
+
+static_assert(ipow(2, 10)==1024);
+static_assert(ipow(10, 19)==10'000'000'000'000'000'000ULL);
+static_assert(modpow(2, 10, 1000)==24);
+static_assert(modpow(3, 200, 1'000'000'007)==modpow(9, 100, 1'000'000'007));
+
+// Compile-time table for 16.ArmstrongNumber.cpp style checks: kDigitPow[d][k] = d^k
+constexpr auto kDigitPow=[]{
+    std::array<std::array<u64, 20>, 10> table{};
+    for(u64 d{};d<10;++d){
+        for(unsigned k{};k<20;++k){
+            table[d][k]=ipow(d, k);
+        }
+    }
+    return table;
+}();
+static_assert(kDigitPow[9][4]==6561);
+
+// out[i] = bases[i]^exp mod m
+void modpow_batch(std::span<const u64> bases, u64 exp, u64 m, std::span<u64> out)
+{
+    const std::size_t count{bases.size()};
+    if(m<=1 || m%2==0){
+        for(std::size_t i{};i<count;++i) out[i]=modpow(bases[i], exp, m);
+        return;
+    }
+
+    if(m<(u64{1}<<31)){
+        const Montgomery32 mont{static_cast<u32>(m)};
+        constexpr std::size_t kLanes{8};
+        std::size_t i{};
+        for(;i+kLanes<=count;i+=kLanes){
+            u64 x[kLanes], result[kLanes];
+            for(std::size_t k{};k<kLanes;++k){
+                x[k]=mont.mul(bases[i+k]%m, mont.r2);
+                result[k]=mont.one;
+            }
+            for(u64 e{exp}; e; e>>=1){
+                if(e&1){
+                    for(std::size_t k{};k<kLanes;++k) result[k]=mont.mul(result[k], x[k]);
+                }
+                for(std::size_t k{};k<kLanes;++k) x[k]=mont.mul(x[k], x[k]);
+            }
+            for(std::size_t k{};k<kLanes;++k) out[i+k]=mont.reduce(result[k]);
+        }
+        for(;i<count;++i) out[i]=modpow(bases[i], exp, m);
+        return;
+    }
+
+    const Montgomery64 mont{m};
+    constexpr std::size_t kLanes{4};
+    std::size_t i{};
+    for(;i+kLanes<=count;i+=kLanes){
+        u64 x[kLanes], result[kLanes];
+        for(std::size_t k{};k<kLanes;++k){
+            x[k]=mont.to(bases[i+k]);
+            result[k]=mont.one;
+        }
+        for(u64 e{exp}; e; e>>=1){
+            if(e&1){
+                for(std::size_t k{};k<kLanes;++k) result[k]=mont.mul(result[k], x[k]);
+            }
+            for(std::size_t k{};k<kLanes;++k) x[k]=mont.mul(x[k], x[k]);
+        }
+        for(std::size_t k{};k<kLanes;++k) out[i+k]=mont.from(result[k]);
+    }
+    for(;i<count;++i) out[i]=mont.from(mont.pow(mont.to(bases[i]), exp));
+}
+
+// Same signature as Codingexercise/CodingExercise45.cpp, O(log n) multiplications.
+int pow(int m, int n)
+{
+    int p{1};
+    while(n>0){
+        if(n&1) p*=m;
+        n>>=1;
+        if(n>0) m*=m;
+    }
+    return p;
+}
+
+// The loop from CodingExercise45.cpp, modulo m so it does not overflow.
+u64 modpowLoop(u64 base, u64 exp, u64 m)
+{
+    u64 p{1%m};
+    for(u64 i{};i<exp;++i){
+        p=static_cast<u64>(static_cast<u128>(p)*base%m);
+    }
+    return p;
+}
+
+int main(){
+    u64 m{};
+    unsigned n{};
+    std::cout<<"Enter m and n:"<<std::flush;
+    std::cin>>m>>n;
+    try{
+        const u64 power{ipow(m, n)};
+        std::cout<<m<<"^"<<n<<" = "<<power<<"\n";
+    }
+    catch(const std::overflow_error& e){
+        std::cout<<e.what()<<"\n";
+    }
+    std::cout<<m<<"^"<<n<<" mod 1000000007 = "<<modpow(m, n, 1'000'000'007)<<"\n";
+    std::cout<<"pow(2,5) = "<<pow(2, 5)<<"\n";
+
+    using Clock=std::chrono::steady_clock;
+    auto msSince=[](Clock::time_point start){
+        return std::chrono::duration<double, std::milli>{Clock::now()-start}.count();
+    };
+
+    // one big exponent: loop vs square-and-multiply
+    const u64 bigMod{(u64{1}<<61)-1};
+    const u64 exp{50'000'000};
+    auto t0{Clock::now()};
+    u64 slow{modpowLoop(3, exp, bigMod)};
+    double loopMs{msSince(t0)};
+    auto t1{Clock::now()};
+    u64 fast{modpow(3, exp, bigMod)};
+    double fastMs{msSince(t1)};
+    std::cout<<"3^"<<exp<<" mod 2^61-1: loop "<<loopMs<<" ms, modpow "<<fastMs<<" ms, "
+             <<(slow==fast ? "same" : "DIFFERENT")<<"\n";
+
+    // batch: many bases, same exponent and modulus
+    std::mt19937_64 rng{11};
+    std::vector<u64> bases(1'000'000), scalar(bases.size()), batch(bases.size());
+    for(u64& b : bases) b=rng();
+    for(u64 mod : {u64{998'244'353}, u64{4'294'967'291}, u64{(u64{1}<<61)-1}, u64{1'000'000'000'000'000'000}}){
+        const u64 e{1'000'003};
+        auto t2{Clock::now()};
+        for(std::size_t i{};i<bases.size();++i) scalar[i]=modpow(bases[i], e, mod);
+        double scalarMs{msSince(t2)};
+        auto t3{Clock::now()};
+        modpow_batch(bases, e, mod, batch);
+        double batchMs{msSince(t3)};
+        std::cout<<"mod "<<mod<<": scalar "<<scalarMs<<" ms, batch "<<batchMs<<" ms, "
+                 <<(scalar==batch ? "same" : "DIFFERENT")<<"\n";
+    }
+    return 0;
+}
+/*
+🔸 Output (sample)
+Enter m and n:2 64
+ipow: result does not fit in 64 bits
+2^64 mod 1000000007 = 582344008
+pow(2,5) = 32
+
+⚠️ Notes
+ - pow(int, int) keeps the exercise's int signature, so it still wraps for
+   results above 2^31-1; use ipow to get an error instead.
+ - Build with -O2 -march=native to let the 32-bit batch path use AVX2/AVX-512.
+*/
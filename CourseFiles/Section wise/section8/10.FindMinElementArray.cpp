@@ -53,3 +53,7 @@ int main(){
 
 
 
+/*
+⚠️ For big arrays (and float/double with NaN) see 31.MinMaxReduction.cpp:
+SIMD min/max/argmin/argmax, optional threads, explicit NaN handling.
+*/
@@ -245,4 +245,9 @@ For a vector, just use:
 		std::vector<int> v = {10, 20, 30};
 		std::cout << v.size();  // Outputs 3
 
+⚡ Faster linear search
+The loops above compare one element per iteration. 28.SIMDLinearSearch.cpp
+compares 4-16 ints per instruction (SSE4.2 / AVX2 / AVX-512, picked at run
+time) and is 4-8x faster on arrays that fit in cache.
+
 */
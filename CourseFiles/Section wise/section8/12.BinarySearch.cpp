@@ -33,10 +33,16 @@ int main(){
 			return 0;
 		}
 		else if(key<a[mid])
-			h=mid-l;
+			h=mid-1;
 		else
-			l=mid+l;
+			l=mid+1;
 	}
 	cout<<"not found";
 	return 0;
 }
+/*
+⚠️ h=mid-1 / l=mid+1 (minus/plus ONE, not the letter l): with mid-l the
+range did not shrink correctly and some keys were never found.
+For large arrays see 29.EytzingerBinarySearch.cpp (cache friendly layout,
+prefetching, branchless steps).
+*/
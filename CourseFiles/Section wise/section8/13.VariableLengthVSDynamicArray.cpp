@@ -82,3 +82,8 @@ If you want dynamic behavior with safety, prefer:
  - Resizable with .push_back(), .resize(), etc.
  - Fully standard C++
 */
+/*
+⚠️ Resizing by new + copy + delete[] costs a full copy each time. A dynamic
+array that doubles its capacity (what std::vector does) is built step by
+step in section9/10.DynArray.cpp.
+*/
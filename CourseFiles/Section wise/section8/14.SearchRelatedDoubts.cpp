@@ -87,4 +87,5 @@ All occurrences	        Store indices	                Any list
 Count occurrences	    Count matches	                Any list
 Last occurrence	        Overwrite index on match	    Any list
 Fast (sorted only)	    lower_bound, upper_bound	    Sorted arrays
+Many keys at once	    lower_bound_many	            Sorted arrays (30.BatchedBinarySearch.cpp)
 */
@@ -19,3 +19,8 @@ int main(){
     }
     cout<<pcount<<" "<<ncount<<"\n";
 }
+/*
+⚠️ With random signs the if(x<0) guesses wrong about half the time. Counting
+with the sign bit (ncount+=(x<0)) and a stable SIMD partition of negatives
+and non-negatives are in 33.SignCountPartition.cpp.
+*/
@@ -22,3 +22,7 @@ int main(){
         cout<<endl;
     }
 }
+/*
+⚠️ endl flushes after every row and every number is its own stream call.
+Printing into a buffer and writing whole blocks is in 38.BufferedPatternRenderer.cpp.
+*/
@@ -23,3 +23,7 @@ int main(){
         cout<<endl;
     }
 }
+/*
+⚠️ Every row is flushed by endl. 38.BufferedPatternRenderer.cpp writes the
+rows in 1 MB blocks.
+*/
@@ -26,3 +26,7 @@ int main(){
     }
 
 }
+/*
+⚠️ The blanks are cout calls too: n*n calls in all. 38.BufferedPatternRenderer.cpp
+copies a whole run of blanks at once.
+*/
@@ -26,3 +26,7 @@ int main() {
 
     return 0;
 }
+/*
+⚠️ Only 2n of the n*n cells are stars; the rest are cout<<"  " calls.
+38.BufferedPatternRenderer.cpp builds each row in a buffer instead.
+*/
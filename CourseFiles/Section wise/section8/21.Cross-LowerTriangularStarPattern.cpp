@@ -23,3 +23,8 @@ int main(){
         cout<<endl;
     }
 }
+/*
+⚠️ Empty cells print nothing here, so the triangle comes out left-aligned,
+not as in the picture above: add else cout<<"  "; (as CodingExercise40 does).
+A buffered version of all the star patterns is in 38.BufferedPatternRenderer.cpp.
+*/
@@ -26,3 +26,7 @@ int main(){
         cout<<endl;
     }
 }
+/*
+⚠️ Row i is n-i stars followed by blanks. 39.ClosedFormPatternRows.cpp
+computes those runs from i and n without testing each cell.
+*/
@@ -25,3 +25,7 @@ int main(){
         cout<<endl;
     }
 }
+/*
+⚠️ For n = 5000 this is 25 million cout calls and 5000 flushes. A whole row
+is one memcpy in 38.BufferedPatternRenderer.cpp (about 10x faster into a file).
+*/
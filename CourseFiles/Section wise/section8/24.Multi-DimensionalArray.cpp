@@ -155,3 +155,8 @@ That means:
         int A[m][n];     // ❌ Error in standard C++
 📌 m and n are not constants — their values are read at runtime via cin.
 */
+/*
+⚠️ vector<vector<int>> allocates every row separately. One contiguous heap
+block with the size read at run time (A[i][j], range-for over rows, column
+and transposed views, move-only) is Matrix2D<T> in 37.Matrix2D.cpp.
+*/
@@ -47,3 +47,8 @@ int main()
 
 	return 0;
 }
+
+/*
+⚠️ The two loops read a and b twice. For big matrices one fused pass
+(c and d written together, a and b read once) is in 36.FusedMatrixAddSub.cpp.
+*/
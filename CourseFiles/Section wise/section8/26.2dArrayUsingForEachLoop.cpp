@@ -84,3 +84,8 @@ auto &row	    Some prefer spacing like int *ptr
 
 
 */
+/*
+⚠️ The same range-for over rows works on a Matrix2D<T> whose size is read
+at run time: for (auto row : A) gives each row as a std::span<int>.
+See 37.Matrix2D.cpp.
+*/
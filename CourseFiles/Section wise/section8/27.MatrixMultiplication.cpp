@@ -58,3 +58,9 @@ int main(){
    
  return 0;
 }
+/*
+⚡ This i-j-k loop reads b down its columns and gets well under 1 GFLOP/s
+for 1024x1024. Loop order i-k-j, cache tiling, a register-blocked
+micro-kernel and threads (~50 GFLOP/s) are in 34.BlockedMatrixMultiplication.cpp.
+For square n >= ~2048, 35.StrassenWinograd.cpp does fewer than n^3 multiplies.
+*/
@@ -0,0 +1,384 @@
+/*
+🔎 SIMD linear search with runtime CPU dispatch
+11.LinearSearch.cpp and Studentpracticeexercise/StudentExercise8.cpp compare
+ONE element per iteration, with a branch every time:
+    for(int i=0;i<n;++i) if(arr[i]==key) return i;
+
+🔹 Compare many elements per instruction
+A SIMD register holds several ints at once:
+    SSE     128 bits →  4 ints (16 chars)
+    AVX2    256 bits →  8 ints (32 chars)
+    AVX-512 512 bits → 16 ints (64 chars)
+One compare instruction tests all lanes against the key (which was copied
+into every lane once, "broadcast") and gives a lane mask:
+    data  :  7  3  9  4  1  9  8  2
+    key   :  9  9  9  9  9  9  9  9
+    equal :  0  0  1  0  0  1  0  0   → movemask → bits 0b00100100
+The first hit is the lowest set bit: std::countr_zero(mask) = 2.
+The loop checks 4 registers per iteration and branches only once, on
+"any lane equal", so most iterations have no taken branch at all.
+
+🔹 Runtime dispatch
+The same program must run on CPUs without AVX2 or AVX-512, so the kernels are
+compiled with __attribute__((target("..."))) (only THAT function may use the
+instructions) and the best one is picked once, at the first call, with
+__builtin_cpu_supports. No -mavx2 / -march flag is needed to build this file.
+
+🔹 Element types
+simd_find<T> works for every 1, 2, 4 and 8 byte integer type plus float and
+double. Floats compare with ==, so -0.0 finds 0.0 and NaN is never found,
+exactly like the scalar loop.
+*/
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <algorithm>
+#include <iomanip>
+#include <type_traits>
+#include <chrono>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+enum class Isa{ Scalar, SSE42, AVX2, AVX512 };
+
+std::string isaName(Isa isa)
+{
+    switch(isa){
+        case Isa::SSE42: return "SSE4.2";
+        case Isa::AVX2: return "AVX2";
+        case Isa::AVX512: return "AVX-512";
+        default: return "scalar";
+    }
+}
+
+template<class T>
+constexpr bool kSearchable=std::is_arithmetic_v<T> && !std::is_same_v<T, bool>
+                          && (sizeof(T)==1 || sizeof(T)==2 || sizeof(T)==4 || sizeof(T)==8);
+
+template<class T>
+std::ptrdiff_t findScalar(const T* data, std::size_t n, T key)
+{
+    for(std::size_t i{};i<n;++i){
+        if(data[i]==key) return static_cast<std::ptrdiff_t>(i);
+    }
+    return -1;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// ---------- SSE4.2: 16-byte registers ----------
+template<class T>
+__attribute__((target("sse4.2"))) inline __m128i splat128(T key)
+{
+    if constexpr(std::is_same_v<T, float>) return _mm_castps_si128(_mm_set1_ps(key));
+    else if constexpr(std::is_same_v<T, double>) return _mm_castpd_si128(_mm_set1_pd(key));
+    else if constexpr(sizeof(T)==1) return _mm_set1_epi8(static_cast<char>(key));
+    else if constexpr(sizeof(T)==2) return _mm_set1_epi16(static_cast<short>(key));
+    else if constexpr(sizeof(T)==4) return _mm_set1_epi32(static_cast<int>(key));
+    else return _mm_set1_epi64x(static_cast<long long>(key));
+}
+
+template<class T>
+__attribute__((target("sse4.2"))) inline __m128i equal128(const T* p, __m128i key)
+{
+    const __m128i v{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))};
+    if constexpr(std::is_same_v<T, float>){
+        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(v), _mm_castsi128_ps(key)));
+    }
+    else if constexpr(std::is_same_v<T, double>){
+        return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(v), _mm_castsi128_pd(key)));
+    }
+    else if constexpr(sizeof(T)==1) return _mm_cmpeq_epi8(v, key);
+    else if constexpr(sizeof(T)==2) return _mm_cmpeq_epi16(v, key);
+    else if constexpr(sizeof(T)==4) return _mm_cmpeq_epi32(v, key);
+    else return _mm_cmpeq_epi64(v, key);
+}
+
+template<class T>
+__attribute__((target("sse4.2"))) std::ptrdiff_t findSSE42(const T* data, std::size_t n, T key)
+{
+    constexpr std::size_t kLanes{16/sizeof(T)};
+    const __m128i k{splat128(key)};
+    std::size_t i{};
+    for(;i+4*kLanes<=n;i+=4*kLanes){
+        const __m128i e[4]{equal128(data+i, k), equal128(data+i+kLanes, k),
+                           equal128(data+i+2*kLanes, k), equal128(data+i+3*kLanes, k)};
+        const __m128i any{_mm_or_si128(_mm_or_si128(e[0], e[1]), _mm_or_si128(e[2], e[3]))};
+        if(_mm_movemask_epi8(any)!=0){
+            for(std::size_t j{};j<4;++j){
+                const unsigned mask{static_cast<unsigned>(_mm_movemask_epi8(e[j]))};
+                if(mask!=0){
+                    return static_cast<std::ptrdiff_t>(i+j*kLanes+std::countr_zero(mask)/sizeof(T));
+                }
+            }
+        }
+    }
+    for(;i+kLanes<=n;i+=kLanes){
+        const unsigned mask{static_cast<unsigned>(_mm_movemask_epi8(equal128(data+i, k)))};
+        if(mask!=0) return static_cast<std::ptrdiff_t>(i+std::countr_zero(mask)/sizeof(T));
+    }
+    const std::ptrdiff_t tail{findScalar(data+i, n-i, key)};
+    return tail<0 ? -1 : static_cast<std::ptrdiff_t>(i)+tail;
+}
+
+// ---------- AVX2: 32-byte registers ----------
+template<class T>
+__attribute__((target("avx2"))) inline __m256i splat256(T key)
+{
+    if constexpr(std::is_same_v<T, float>) return _mm256_castps_si256(_mm256_set1_ps(key));
+    else if constexpr(std::is_same_v<T, double>) return _mm256_castpd_si256(_mm256_set1_pd(key));
+    else if constexpr(sizeof(T)==1) return _mm256_set1_epi8(static_cast<char>(key));
+    else if constexpr(sizeof(T)==2) return _mm256_set1_epi16(static_cast<short>(key));
+    else if constexpr(sizeof(T)==4) return _mm256_set1_epi32(static_cast<int>(key));
+    else return _mm256_set1_epi64x(static_cast<long long>(key));
+}
+
+template<class T>
+__attribute__((target("avx2"))) inline __m256i equal256(const T* p, __m256i key)
+{
+    const __m256i v{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))};
+    if constexpr(std::is_same_v<T, float>){
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(v), _mm256_castsi256_ps(key), _CMP_EQ_OQ));
+    }
+    else if constexpr(std::is_same_v<T, double>){
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(v), _mm256_castsi256_pd(key), _CMP_EQ_OQ));
+    }
+    else if constexpr(sizeof(T)==1) return _mm256_cmpeq_epi8(v, key);
+    else if constexpr(sizeof(T)==2) return _mm256_cmpeq_epi16(v, key);
+    else if constexpr(sizeof(T)==4) return _mm256_cmpeq_epi32(v, key);
+    else return _mm256_cmpeq_epi64(v, key);
+}
+
+template<class T>
+__attribute__((target("avx2"))) std::ptrdiff_t findAVX2(const T* data, std::size_t n, T key)
+{
+    constexpr std::size_t kLanes{32/sizeof(T)};
+    const __m256i k{splat256(key)};
+    std::size_t i{};
+    for(;i+4*kLanes<=n;i+=4*kLanes){
+        const __m256i e[4]{equal256(data+i, k), equal256(data+i+kLanes, k),
+                           equal256(data+i+2*kLanes, k), equal256(data+i+3*kLanes, k)};
+        const __m256i any{_mm256_or_si256(_mm256_or_si256(e[0], e[1]), _mm256_or_si256(e[2], e[3]))};
+        if(!_mm256_testz_si256(any, any)){
+            for(std::size_t j{};j<4;++j){
+                const unsigned mask{static_cast<unsigned>(_mm256_movemask_epi8(e[j]))};
+                if(mask!=0){
+                    return static_cast<std::ptrdiff_t>(i+j*kLanes+std::countr_zero(mask)/sizeof(T));
+                }
+            }
+        }
+    }
+    for(;i+kLanes<=n;i+=kLanes){
+        const unsigned mask{static_cast<unsigned>(_mm256_movemask_epi8(equal256(data+i, k)))};
+        if(mask!=0) return static_cast<std::ptrdiff_t>(i+std::countr_zero(mask)/sizeof(T));
+    }
+    const std::ptrdiff_t tail{findScalar(data+i, n-i, key)};
+    return tail<0 ? -1 : static_cast<std::ptrdiff_t>(i)+tail;
+}
+
+// ---------- AVX-512: 64-byte registers, compares give a bit per lane ----------
+template<class T>
+__attribute__((target("avx512f,avx512bw"))) inline __m512i splat512(T key)
+{
+    if constexpr(std::is_same_v<T, float>) return _mm512_castps_si512(_mm512_set1_ps(key));
+    else if constexpr(std::is_same_v<T, double>) return _mm512_castpd_si512(_mm512_set1_pd(key));
+    else if constexpr(sizeof(T)==1) return _mm512_set1_epi8(static_cast<char>(key));
+    else if constexpr(sizeof(T)==2) return _mm512_set1_epi16(static_cast<short>(key));
+    else if constexpr(sizeof(T)==4) return _mm512_set1_epi32(static_cast<int>(key));
+    else return _mm512_set1_epi64(static_cast<long long>(key));
+}
+
+template<class T>
+__attribute__((target("avx512f,avx512bw"))) inline std::uint64_t equalMask512(__m512i v, __m512i key)
+{
+    if constexpr(std::is_same_v<T, float>){
+        return _mm512_cmp_ps_mask(_mm512_castsi512_ps(v), _mm512_castsi512_ps(key), _CMP_EQ_OQ);
+    }
+    else if constexpr(std::is_same_v<T, double>){
+        return _mm512_cmp_pd_mask(_mm512_castsi512_pd(v), _mm512_castsi512_pd(key), _CMP_EQ_OQ);
+    }
+    else if constexpr(sizeof(T)==1) return _mm512_cmpeq_epi8_mask(v, key);
+    else if constexpr(sizeof(T)==2) return _mm512_cmpeq_epi16_mask(v, key);
+    else if constexpr(sizeof(T)==4) return _mm512_cmpeq_epi32_mask(v, key);
+    else return _mm512_cmpeq_epi64_mask(v, key);
+}
+
+// Loads only the lanes in `lanes` (the others read as 0 and touch no memory).
+template<class T>
+__attribute__((target("avx512f,avx512bw"))) inline __m512i maskedLoad512(const T* p, std::uint64_t lanes)
+{
+    if constexpr(sizeof(T)==1) return _mm512_maskz_loadu_epi8(lanes, p);
+    else if constexpr(sizeof(T)==2) return _mm512_maskz_loadu_epi16(static_cast<__mmask32>(lanes), p);
+    else if constexpr(sizeof(T)==4) return _mm512_maskz_loadu_epi32(static_cast<__mmask16>(lanes), p);
+    else return _mm512_maskz_loadu_epi64(static_cast<__mmask8>(lanes), p);
+}
+
+template<class T>
+__attribute__((target("avx512f,avx512bw"))) std::ptrdiff_t findAVX512(const T* data, std::size_t n, T key)
+{
+    constexpr std::size_t kLanes{64/sizeof(T)};
+    const __m512i k{splat512(key)};
+    std::size_t i{};
+    for(;i+4*kLanes<=n;i+=4*kLanes){
+        std::uint64_t m[4];
+        for(std::size_t j{};j<4;++j){
+            m[j]=equalMask512<T>(_mm512_loadu_si512(data+i+j*kLanes), k);
+        }
+        if((m[0]|m[1]|m[2]|m[3])!=0){
+            for(std::size_t j{};j<4;++j){
+                if(m[j]!=0) return static_cast<std::ptrdiff_t>(i+j*kLanes+std::countr_zero(m[j]));
+            }
+        }
+    }
+    // the last < 4 registers: masked loads, no scalar tail
+    for(;i<n;i+=kLanes){
+        const std::size_t left{n-i};
+        const std::uint64_t lanes{left>=kLanes ? (kLanes==64 ? ~std::uint64_t{0} : (std::uint64_t{1}<<kLanes)-1)
+                                               : (std::uint64_t{1}<<left)-1};
+        const std::uint64_t mask{equalMask512<T>(maskedLoad512(data+i, lanes), k)&lanes};
+        if(mask!=0) return static_cast<std::ptrdiff_t>(i+std::countr_zero(mask));
+    }
+    return -1;
+}
+
+#endif
+
+Isa detect_isa()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return Isa::AVX512;
+    if(__builtin_cpu_supports("avx2")) return Isa::AVX2;
+    if(__builtin_cpu_supports("sse4.2")) return Isa::SSE42;
+#endif
+    return Isa::Scalar;
+}
+
+template<class T>
+using FindFunction=std::ptrdiff_t(*)(const T*, std::size_t, T);
+
+// The kernel for `isa`; falls back to scalar when it is not compiled in.
+template<class T>
+FindFunction<T> find_kernel(Isa isa)
+{
+    static_assert(kSearchable<T>, "simd_find needs an integer or floating point type of 1, 2, 4 or 8 bytes");
+#if defined(__x86_64__) || defined(__i386__)
+    switch(isa){
+        case Isa::AVX512: return &findAVX512<T>;
+        case Isa::AVX2: return &findAVX2<T>;
+        case Isa::SSE42: return &findSSE42<T>;
+        default: break;
+    }
+#endif
+    (void)isa;
+    return &findScalar<T>;
+}
+
+// Index of the first element equal to key, or -1. Uses the widest
+// instruction set the CPU supports (chosen once per element type).
+template<class T>
+std::ptrdiff_t simd_find(const T* data, std::size_t n, T key)
+{
+    static const FindFunction<T> kernel{find_kernel<T>(detect_isa())};
+    return kernel(data, n, key);
+}
+
+// Same signature as Studentpracticeexercise/StudentExercise8.cpp
+int linearSearch(int arr[], int n, int key)
+{
+    if(n<=0) return -1;
+    return static_cast<int>(simd_find(arr, static_cast<std::size_t>(n), key));
+}
+
+int main(){
+    int A[9];
+    int size{5};
+    std::cout<<"Enter 5 numbers:\n";
+    for(int i{};i<size;++i) std::cin>>A[i];
+    int key{};
+    std::cout<<"Enter the number to search: "<<std::flush;
+    std::cin>>key;
+    int index{linearSearch(A, size, key)};
+    if(index!=-1) std::cout<<"Found at index: "<<index<<"\n";
+    else std::cout<<"Element not found.\n";
+
+    const Isa best{detect_isa()};
+    std::cout<<"CPU supports: "<<isaName(best)<<"\n";
+
+    // every kernel agrees with the scalar loop, for every type and position
+    bool ok{true};
+    auto check=[&](auto sample){
+        using T=decltype(sample);
+        std::vector<T> v(300);
+        for(std::size_t i{};i<v.size();++i) v[i]=static_cast<T>(i%100+1);
+        for(int isa{};isa<=static_cast<int>(best);++isa){
+            FindFunction<T> f{find_kernel<T>(static_cast<Isa>(isa))};
+            for(std::size_t n{};n<=v.size();n+=7){
+                for(T k : {T{1}, T{50}, T{100}, T{0}}){
+                    ok=ok && f(v.data(), n, k)==findScalar(v.data(), n, k);
+                }
+            }
+        }
+    };
+    check(std::int8_t{}); check(std::uint16_t{}); check(int{}); check(std::int64_t{});
+    check(float{}); check(double{});
+    std::cout<<"all kernels match the scalar loop: "<<(ok ? "yes" : "NO")<<"\n";
+
+    // Benchmark: key not present, so every element is compared
+    using Clock=std::chrono::steady_clock;
+    std::vector<int> data(100'000'000);
+    for(std::size_t i{};i<data.size();++i) data[i]=static_cast<int>(i&0xFFFF);
+    std::cout<<"elements/ns for n =";
+    for(int isa{};isa<=static_cast<int>(best);++isa) std::cout<<std::setw(10)<<isaName(static_cast<Isa>(isa));
+    std::cout<<"\n"<<std::fixed<<std::setprecision(2);
+    for(std::size_t n : {std::size_t{16}, std::size_t{256}, std::size_t{4096}, std::size_t{65536},
+                         std::size_t{1'000'000}, std::size_t{100'000'000}}){
+        std::cout<<std::setw(19)<<n;
+        const std::size_t reps{std::max<std::size_t>(1, 200'000'000/n)};
+        for(int isa{};isa<=static_cast<int>(best);++isa){
+            FindFunction<int> f{find_kernel<int>(static_cast<Isa>(isa))};
+            std::ptrdiff_t sink{};
+            auto t0{Clock::now()};
+            for(std::size_t r{};r<reps;++r){
+                sink+=f(data.data(), n, -1-static_cast<int>(r&1));
+            }
+            std::chrono::duration<double, std::nano> ns{Clock::now()-t0};
+            if(sink!=-static_cast<std::ptrdiff_t>(reps)) ok=false;
+            std::cout<<std::setw(10)<<static_cast<double>(n)*reps/ns.count();
+        }
+        std::cout<<"\n";
+    }
+    return 0;
+}
+/*
+🔸 Output (sample, 2 GHz Xeon with AVX-512)
+Enter 5 numbers:
+4 2 9 7 1
+Enter the number to search: 9
+Found at index: 2
+CPU supports: AVX-512
+all kernels match the scalar loop: yes
+elements/ns for n =    scalar    SSE4.2      AVX2   AVX-512
+                 16      0.87      2.20      1.78      2.07
+                256      1.05      4.82      7.92      6.62
+               4096      1.13      4.91      8.38      7.86
+              65536      1.15      5.31      8.06      7.55
+            1000000      1.15      3.91      4.46      3.84
+          100000000      0.99      1.88      2.16      1.87
+
+⚠️ Notes
+ - Small arrays (16 ints) are dominated by the call itself; the gain grows
+   with n until the array no longer fits in cache, where every version is
+   limited by memory bandwidth (10^8 ints = 400 MB).
+ - On this machine AVX-512 is no faster than AVX2 (the loop is limited by
+   loads, not by compares, and wide registers can lower the clock). The
+   dispatch still prefers it; measure on the target machine.
+ - The kernels read in unaligned 16/32/64-byte blocks but never past
+   data+n: the SSE/AVX2 tails are scalar and the AVX-512 tail uses masked loads.
+*/
@@ -0,0 +1,222 @@
+/*
+🌳 Eytzinger layout: a cache friendly binary search
+12.BinarySearch.cpp halves a sorted array each step. On a large array every
+step lands far away from the previous one, so almost every step is a cache
+miss (~100 ns), and whether we go left or right is a coin flip the branch
+predictor cannot guess.
+
+🔹 Eytzinger (BFS) order
+Store the implicit search tree level by level, like a heap:
+    tree[1]      = root (the median)
+    tree[2k]     = left child of k
+    tree[2k+1]   = right child of k
+Sorted {1,2,3,4,5,6,7}  →  tree[1..7] = {4, 2, 6, 1, 3, 5, 7}
+The first levels of the tree are now next to each other, so the top of every
+search is always in cache.
+
+🔹 Prefetching the descendants
+The 16 great-great-grandchildren of k are tree[16k .. 16k+15]: ONE 64-byte
+cache line (for 4-byte keys). Prefetching it while the 4 levels above are
+being compared hides most of the memory latency.
+
+🔹 Branchless descent
+    k = 2*k + (tree[k] < key);      // no if: left or right by arithmetic
+At the end the path in k says where we turned; the answer (the last node
+where we went LEFT) is found by removing the trailing 1-bits plus one:
+    k >>= std::countr_one(k) + 1;    // 0 → no element >= key
+
+🔹 Branchless lower_bound on the sorted array
+branchless_lower_bound() keeps the normal layout but replaces the if/else
+with a conditional move, a good middle ground when the array cannot be
+rebuilt.
+*/
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <memory>
+#include <optional>
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <chrono>
+#include <random>
+#include <iomanip>
+
+// Static search index over a sorted array, stored in Eytzinger order.
+template<class T>
+class EytzingerIndex{
+    static_assert(std::is_trivially_copyable_v<T>, "EytzingerIndex stores plain values");
+
+public:
+    explicit EytzingerIndex(std::span<const T> sorted)
+        : n{sorted.size()}, tree{allocate(n+1)}
+    {
+        std::size_t next{};
+        build(sorted, next, 1);
+    }
+
+    std::size_t size() const { return n; }
+
+    // Smallest element >= key, or nothing when every element is < key.
+    std::optional<T> lower_bound(const T& key) const
+    {
+        const std::size_t k{slot(key)};
+        if(k==0) return std::nullopt;
+        return tree[k];
+    }
+
+    bool contains(const T& key) const
+    {
+        const std::size_t k{slot(key)};
+        return k!=0 && !(key<tree[k]);
+    }
+
+private:
+    static constexpr std::size_t kLine{64};
+    static constexpr std::size_t kPerLine{kLine/sizeof(T)>0 ? kLine/sizeof(T) : 1};
+
+    struct AlignedFree{
+        void operator()(T* p) const { std::free(p); }
+    };
+
+    static std::unique_ptr<T[], AlignedFree> allocate(std::size_t count)
+    {
+        // aligned so that tree[16k .. 16k+15] is exactly one cache line
+        const std::size_t bytes{(count*sizeof(T)+kLine-1)/kLine*kLine};
+        T* p{static_cast<T*>(std::aligned_alloc(kLine, bytes))};
+        if(p==nullptr) throw std::bad_alloc{};
+        return std::unique_ptr<T[], AlignedFree>{p};
+    }
+
+    // in-order walk of the implicit tree = sorted order
+    void build(std::span<const T> sorted, std::size_t& next, std::size_t k)
+    {
+        if(k>n) return;
+        build(sorted, next, 2*k);
+        tree[k]=sorted[next++];
+        build(sorted, next, 2*k+1);
+    }
+
+    // Eytzinger slot of the lower bound, 0 if none.
+    std::size_t slot(const T& key) const
+    {
+        const std::uintptr_t base{reinterpret_cast<std::uintptr_t>(tree.get())};
+        std::size_t k{1};
+        while(k<=n){
+            // descendants kPerLine levels-worth below k; prefetching past the
+            // end of the array is harmless, it never faults
+            __builtin_prefetch(reinterpret_cast<const void*>(base+k*kPerLine*sizeof(T)));
+            k=2*k+static_cast<std::size_t>(tree[k]<key);
+        }
+        return k>>(std::countr_one(k)+1);
+    }
+
+    std::size_t n{};
+    std::unique_ptr<T[], AlignedFree> tree;     // tree[0] unused
+};
+
+// Index of the first element >= key in a sorted array (like std::lower_bound),
+// with the left/right choice done by a conditional move instead of a branch.
+template<class T>
+std::size_t branchless_lower_bound(std::span<const T> sorted, const T& key)
+{
+    if(sorted.empty()) return 0;
+    const T* base{sorted.data()};
+    std::size_t length{sorted.size()};
+    while(length>1){
+        const std::size_t half{length/2};
+        base=(base[half-1]<key) ? base+half : base;
+        length-=half;
+    }
+    return static_cast<std::size_t>(base-sorted.data())+static_cast<std::size_t>(*base<key);
+}
+
+// The loop from 12.BinarySearch.cpp (with h=mid-1 / l=mid+1), kept for the benchmark.
+int binarySearch(const int* a, int n, int key)
+{
+    int l{0}, h{n-1};
+    while(l<=h){
+        const int mid{l+(h-l)/2};
+        if(key==a[mid]) return mid;
+        else if(key<a[mid]) h=mid-1;
+        else l=mid+1;
+    }
+    return -1;
+}
+
+int main(){
+    const std::vector<int> a{6, 8, 13, 17, 20, 22, 25, 28, 30, 35};
+    const EytzingerIndex<int> index{a};
+    int key{};
+    std::cout<<"enter the key"<<std::flush;
+    std::cin>>key;
+    if(index.contains(key)){
+        std::cout<<"found at "<<branchless_lower_bound<int>(a, key)<<"\n";
+    }
+    else if(std::optional<int> next{index.lower_bound(key)}){
+        std::cout<<"not found, next larger is "<<*next<<"\n";
+    }
+    else{
+        std::cout<<"not found, larger than every element\n";
+    }
+
+    // Benchmark: 10^6 random lookups into arrays of growing size
+    using Clock=std::chrono::steady_clock;
+    std::mt19937 rng{13};
+    std::cout<<std::fixed<<std::setprecision(1)
+             <<"        n    loop   std::lower_bound   branchless   Eytzinger   (ns/lookup)\n";
+    for(std::size_t n : {std::size_t{10'000}, std::size_t{1'000'000}, std::size_t{100'000'000}}){
+        std::vector<int> sorted(n);
+        for(std::size_t i{};i<n;++i) sorted[i]=static_cast<int>(2*i+1);     // odd keys only
+        const EytzingerIndex<int> eytzinger{sorted};
+        std::vector<int> keys(1'000'000);
+        for(int& k : keys) k=static_cast<int>(rng()%(2*n+2));
+
+        long long sums[4]{};
+        double ns[4]{};
+        for(int method{};method<4;++method){
+            auto t0{Clock::now()};
+            long long sum{};
+            for(int k : keys){
+                switch(method){
+                    case 0: sum+=binarySearch(sorted.data(), static_cast<int>(n), k|1); break;
+                    case 1: sum+=std::lower_bound(sorted.begin(), sorted.end(), k)-sorted.begin(); break;
+                    case 2: sum+=static_cast<long long>(branchless_lower_bound<int>(sorted, k)); break;
+                    default: sum+=eytzinger.lower_bound(k).value_or(-1); break;
+                }
+            }
+            std::chrono::duration<double, std::nano> d{Clock::now()-t0};
+            ns[method]=d.count()/keys.size();
+            sums[method]=sum;
+        }
+        // cross-check: rank r of the lower bound means the value sorted[r]
+        long long expected{};
+        for(int k : keys){
+            const std::size_t r{static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), k)-sorted.begin())};
+            expected+=r<n ? sorted[r] : -1;
+        }
+        std::cout<<std::setw(9)<<n<<std::setw(8)<<ns[0]<<std::setw(19)<<ns[1]<<std::setw(13)<<ns[2]
+                 <<std::setw(12)<<ns[3]<<(sums[1]==sums[2] && sums[3]==expected ? "" : "  MISMATCH")<<"\n";
+    }
+    return 0;
+}
+/*
+🔸 Output (sample, 2 GHz VM)
+enter the key21
+not found, next larger is 22
+        n    loop   std::lower_bound   branchless   Eytzinger   (ns/lookup)
+    10000   134.8              142.5        134.9        47.2
+  1000000   354.2              345.3        280.0       104.6
+100000000  1541.2             1259.8       1278.4       424.3
+
+⚠️ Notes
+ - The index stores a copy of the keys; build it once, query many times.
+   Updating a single key means rebuilding, so this is for static data.
+ - lower_bound returns the VALUE, not the position in the sorted array: the
+   Eytzinger slot says nothing about the rank. Store (key, payload) pairs
+   as T (with operator<) if you need more than the key.
+*/
@@ -0,0 +1,151 @@
+/*
+🧺 Batched binary search: many keys in lockstep
+12.BinarySearch.cpp (and the lower_bound examples in 14.SearchRelatedDoubts.cpp)
+answer ONE key at a time. In a big array every step of a search is a cache
+miss, and step i+1 cannot start before step i has loaded its element:
+    key 1: miss → miss → miss → ... → done
+    key 2:                               miss → miss → ...
+~27 serialised misses per key for 10^8 elements.
+
+🔹 Interleaving (group prefetching / AMAC style)
+The CPU can wait for about 10-20 misses AT THE SAME TIME, but only if they do
+not depend on each other. Different keys are independent, so run a group of
+G searches together, one step each, round-robin:
+    step 1: key 1, key 2, ..., key G      (G independent loads in flight)
+    step 2: key 1, key 2, ..., key G
+    ...
+Now G misses overlap and the time per key drops by up to G times (until the
+memory system is saturated).
+
+🔹 Why the searches stay in lockstep
+The branchless lower_bound (see 29.EytzingerBinarySearch.cpp) halves the
+LENGTH every step regardless of the comparison:
+    while(length>1){ half=length/2; base=(base[half-1]<key) ? base+half : base; length-=half; }
+The number of steps only depends on n, so all G searches finish together and
+no bookkeeping per key is needed. Right after a key moves, the address its
+next step will read (base[nextHalf-1]) is already known, so it is prefetched
+at once instead of G-1 searches later.
+*/
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <algorithm>
+#include <cstddef>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <stdexcept>
+
+// out[i] = index of the first element of `sorted` that is >= keys[i]
+// (same answers as std::lower_bound). kGroup searches run interleaved.
+template<class T, std::size_t kGroup=16>
+void lower_bound_many(std::span<const T> sorted, std::span<const T> keys, std::span<std::size_t> out)
+{
+    if(out.size()<keys.size()) throw std::invalid_argument("lower_bound_many: out is smaller than keys");
+    const std::size_t n{sorted.size()};
+    if(n==0){
+        std::fill(out.begin(), out.begin()+keys.size(), 0);
+        return;
+    }
+
+    const T* const data{sorted.data()};
+    for(std::size_t first{};first<keys.size();first+=kGroup){
+        const std::size_t count{std::min(kGroup, keys.size()-first)};
+        const T* base[kGroup];
+        for(std::size_t g{};g<count;++g) base[g]=data;
+
+        for(std::size_t length{n};length>1;){
+            const std::size_t half{length/2};
+            const std::size_t nextHalf{(length-half)/2};
+            for(std::size_t g{};g<count;++g){
+                base[g]=(base[g][half-1]<keys[first+g]) ? base[g]+half : base[g];
+                // the next step reads base[nextHalf-1]; start loading it now
+                if(nextHalf>0) __builtin_prefetch(base[g]+nextHalf-1);
+            }
+            length-=half;
+        }
+        for(std::size_t g{};g<count;++g){
+            out[first+g]=static_cast<std::size_t>(base[g]-data)+static_cast<std::size_t>(*base[g]<keys[first+g]);
+        }
+    }
+}
+
+int main(){
+    const std::vector<int> a{6, 8, 13, 17, 20, 22, 25, 28, 30, 35};
+    std::vector<int> keys;
+    int count{};
+    std::cout<<"how many keys?"<<std::flush;
+    std::cin>>count;
+    std::cout<<"enter the keys"<<std::flush;
+    for(int i{};i<count;++i){
+        int key{};
+        std::cin>>key;
+        keys.push_back(key);
+    }
+    std::vector<std::size_t> positions(keys.size());
+    lower_bound_many<int>(a, keys, positions);
+    for(std::size_t i{};i<keys.size();++i){
+        const std::size_t p{positions[i]};
+        if(p<a.size() && a[p]==keys[i]) std::cout<<keys[i]<<": found at "<<p<<"\n";
+        else std::cout<<keys[i]<<": not found\n";
+    }
+
+    // Throughput benchmark: 2*10^6 random keys against arrays of growing size
+    using Clock=std::chrono::steady_clock;
+    std::mt19937 rng{17};
+    std::cout<<std::fixed<<std::setprecision(1)
+             <<"        n   one at a time   group 4   group 8   group 16   group 32   (million lookups/s)\n";
+    for(std::size_t n : {std::size_t{10'000}, std::size_t{1'000'000}, std::size_t{100'000'000}}){
+        std::vector<int> sorted(n);
+        for(std::size_t i{};i<n;++i) sorted[i]=static_cast<int>(2*i);
+        std::vector<int> queries(2'000'000);
+        for(int& q : queries) q=static_cast<int>(rng()%(2*n+1));
+
+        std::vector<std::size_t> expected(queries.size()), got(queries.size());
+        auto mps=[&](auto run){
+            auto t0{Clock::now()};
+            run();
+            std::chrono::duration<double> s{Clock::now()-t0};
+            return queries.size()/s.count()/1e6;
+        };
+        const double single{mps([&]{
+            for(std::size_t i{};i<queries.size();++i){
+                expected[i]=static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), queries[i])-sorted.begin());
+            }
+        })};
+        std::cout<<std::setw(9)<<n<<std::setw(16)<<single;
+        bool ok{true};
+        const double g4{mps([&]{ lower_bound_many<int, 4>(sorted, queries, got); })};
+        ok=ok && got==expected;
+        const double g8{mps([&]{ lower_bound_many<int, 8>(sorted, queries, got); })};
+        ok=ok && got==expected;
+        const double g16{mps([&]{ lower_bound_many<int, 16>(sorted, queries, got); })};
+        ok=ok && got==expected;
+        const double g32{mps([&]{ lower_bound_many<int, 32>(sorted, queries, got); })};
+        ok=ok && got==expected;
+        std::cout<<std::setw(10)<<g4<<std::setw(10)<<g8<<std::setw(11)<<g16<<std::setw(11)<<g32
+                 <<(ok ? "" : "   MISMATCH")<<"\n";
+    }
+    return 0;
+}
+/*
+🔸 Output (sample)
+how many keys?3
+enter the keys22 7 35
+22: found at 5
+7: not found
+35: found at 9
+        n   one at a time   group 4   group 8   group 16   group 32   (million lookups/s)
+    10000             7.5       6.7       6.5        7.2        7.7
+  1000000             3.4       4.1       4.3        4.8        5.0
+100000000             0.8       1.5       2.0        2.6        2.8
+
+⚠️ Notes
+ - A small array fits in cache, so there are no misses to overlap and
+   batching gains nothing; at 10^8 elements group 32 is ~3.5x faster.
+ - The answers come back in the order of the keys; the keys do not need to
+   be sorted.
+ - Bigger groups help until the CPU runs out of miss slots (line fill
+   buffers, ~10-20 per core); past that they only add register pressure.
+*/
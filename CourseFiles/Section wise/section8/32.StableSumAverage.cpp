@@ -0,0 +1,501 @@
+/*
+➕ Sums and averages that stay exact (or close) on big arrays
+8.SumOfElementsOfArray.cpp and Codingexercise/CodingExercise33.cpp add ints
+into an int, and Studentpracticeexercise/StudentExercise6.cpp adds up to 100
+numbers into one float:
+ - int  : 10^5 values of 10^5 already overflow (2^31 ≈ 2.1*10^9)
+ - float: has 24 bits of precision; once sum ≈ 2^24 = 16777216, adding 1.0f
+          does NOTHING (16777216.0f + 1.0f == 16777216.0f)
+ - both use one core and store every number first.
+
+🔹 Integer sums: widen, then SIMD
+Each int is widened to 64 bits before adding (exact for 2^32 int32 values):
+a vector of ints is interleaved with a vector of its sign bits, which read
+as 64-bit lanes IS the widened value. The loop keeps 4 vectors of 64-bit
+partial sums (GCC vector extensions), so several additions happen per
+instruction and in parallel. 8/16-bit values are summed in 32-bit blocks
+first; 64-bit inputs are added in 128 bits and std::overflow_error is thrown
+if the total does not fit.
+
+🔹 Floating sums
+ - pairwise: split the array in halves, sum each half, add the two results.
+   Rounding error grows like log2(n) instead of n. Below 256 elements the
+   block is summed with vector accumulators.
+ - Kahan: carry the rounding error of every addition in a compensation c
+   and feed it back into the next one:
+        y = x - c;  t = sum + y;  c = (t - sum) - y;  sum = t;
+   The error then does not grow with n at all. Done per SIMD lane, the lanes
+   are combined at the end with Neumaier's variant.
+   ⚠️ Do not build with -ffast-math: it lets the compiler "simplify"
+   (t - sum) - y to 0 and the compensation disappears.
+
+🔹 Threads
+ThreadPool keeps a few worker threads alive and runs submitted tasks.
+parallel_sum() cuts the array into FIXED 65536-element chunks, sums each
+chunk as a task and adds the chunk results in order, so the answer is the
+same bit for bit no matter how many threads ran.
+
+🔹 Streaming mean / variance
+RunningStats never stores the data: it keeps count, mean and M2 (sum of
+squared distances from the mean) and merges every new chunk with Chan's
+formula:
+    delta = meanB - meanA
+    mean  = meanA + delta * nB / n
+    M2    = M2A + M2B + delta^2 * nA * nB / n
+variance = M2 / n. This avoids the classic sum(x^2)/n - mean^2, which
+cancels catastrophically when the mean is large.
+*/
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <queue>
+#include <memory>
+#include <chrono>
+#include <random>
+#include <iomanip>
+
+#if defined(__AVX512F__)
+constexpr std::size_t kVectorBytes{64};
+#elif defined(__AVX2__)
+constexpr std::size_t kVectorBytes{32};
+#else
+constexpr std::size_t kVectorBytes{16};     // SSE2, always there on x86-64
+#endif
+
+// Result type of an integer sum: 64 bits, same signedness as T.
+template<class T>
+using WideSum=std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+
+// Little endian interleave of half of lo with half of hi: lanes
+// lo[k], hi[k], lo[k+1], hi[k+1], ... starting at k = kOffset. Read as 64-bit
+// lanes this is lo[k] widened with hi[k] as its upper 32 bits.
+template<std::size_t kOffset, class V, std::size_t... I>
+V interleave(V lo, V hi, std::index_sequence<I...>)
+{
+    return __builtin_shufflevector(lo, hi, (I%2==0 ? kOffset+I/2 : sizeof...(I)+kOffset+I/2)...);
+}
+
+template<class T>
+WideSum<T> sum_int(std::span<const T> data)
+{
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+    using W=WideSum<T>;
+    const T* p{data.data()};
+    const std::size_t n{data.size()};
+
+    if constexpr(sizeof(T)==8){
+        // 128-bit running sums cannot overflow for any realistic n
+        using Big=std::conditional_t<std::is_signed_v<T>, __int128, unsigned __int128>;
+        Big acc[4]{};
+        std::size_t i{};
+        for(;i+4<=n;i+=4){
+            for(std::size_t u{};u<4;++u) acc[u]+=p[i+u];
+        }
+        for(;i<n;++i) acc[0]+=p[i];
+        const Big total{acc[0]+acc[1]+acc[2]+acc[3]};
+        if(total>static_cast<Big>(std::numeric_limits<W>::max()) || total<static_cast<Big>(std::numeric_limits<W>::min())){
+            throw std::overflow_error("sum_int: total does not fit in 64 bits");
+        }
+        return static_cast<W>(total);
+    }
+    else if constexpr(sizeof(T)==4){
+        constexpr std::size_t kLanes{kVectorBytes/sizeof(T)};
+        typedef T V __attribute__((vector_size(kVectorBytes)));
+        typedef W WV __attribute__((vector_size(kVectorBytes)));
+        constexpr auto kIndex{std::make_index_sequence<kLanes>{}};
+        WV acc[4]{};
+        std::size_t i{};
+        for(;i+2*kLanes<=n;i+=2*kLanes){
+            for(std::size_t u{};u<2;++u){
+                V v;
+                std::memcpy(&v, p+i+u*kLanes, sizeof(V));
+                // upper 32 bits of each widened value: copies of the sign bit
+                // (signed) or zeros (unsigned)
+                V upper{};
+                if constexpr(std::is_signed_v<T>) upper=v>>31;
+                acc[2*u]+=(WV)interleave<0>(v, upper, kIndex);
+                acc[2*u+1]+=(WV)interleave<kLanes/2>(v, upper, kIndex);
+            }
+        }
+        const WV all{(acc[0]+acc[1])+(acc[2]+acc[3])};
+        W total{};
+        for(std::size_t k{};k<kLanes/2;++k) total+=all[k];
+        for(;i<n;++i) total+=p[i];
+        return total;
+    }
+    else{
+        // 8/16-bit values: 32768 of them always fit in a 32-bit partial sum
+        constexpr std::size_t kBlock{32768};
+        using Partial=std::conditional_t<std::is_signed_v<T>, std::int32_t, std::uint32_t>;
+        W total{};
+        for(std::size_t begin{};begin<n;begin+=kBlock){
+            const std::size_t end{std::min(n, begin+kBlock)};
+            Partial acc[4]{};
+            std::size_t i{begin};
+            for(;i+4<=end;i+=4){
+                for(std::size_t u{};u<4;++u) acc[u]+=p[i+u];
+            }
+            for(;i<end;++i) acc[0]+=p[i];
+            total+=static_cast<W>(acc[0])+acc[1]+acc[2]+acc[3];
+        }
+        return total;
+    }
+}
+
+// Plain sum with vector accumulators, used for the small blocks of pairwise.
+template<class F>
+F blockSum(const F* p, std::size_t n)
+{
+    constexpr std::size_t kLanes{kVectorBytes/sizeof(F)};
+    typedef F V __attribute__((vector_size(kVectorBytes)));
+    V acc[4]{};
+    std::size_t i{};
+    for(;i+4*kLanes<=n;i+=4*kLanes){
+        for(std::size_t u{};u<4;++u){
+            V v;
+            std::memcpy(&v, p+i+u*kLanes, sizeof(V));
+            acc[u]+=v;
+        }
+    }
+    const V all{(acc[0]+acc[1])+(acc[2]+acc[3])};
+    F total{};
+    for(std::size_t k{};k<kLanes;++k) total+=all[k];
+    for(;i<n;++i) total+=p[i];
+    return total;
+}
+
+template<class F>
+F sum_pairwise(std::span<const F> data)
+{
+    static_assert(std::is_floating_point_v<F>);
+    constexpr std::size_t kBase{256};
+    if(data.size()<=kBase) return blockSum(data.data(), data.size());
+    const std::size_t half{data.size()/2};
+    return sum_pairwise(data.first(half))+sum_pairwise(data.subspan(half));
+}
+
+// Neumaier (improved Kahan) accumulator, used to combine partial results.
+template<class F>
+struct CompensatedSum{
+    F sum{};
+    F c{};
+
+    void add(F x)
+    {
+        const F t{sum+x};
+        if(std::abs(sum)>=std::abs(x)) c+=(sum-t)+x;
+        else c+=(x-t)+sum;
+        sum=t;
+    }
+
+    F value() const { return sum+c; }
+};
+
+template<class F>
+F sum_kahan(std::span<const F> data)
+{
+    static_assert(std::is_floating_point_v<F>);
+    constexpr std::size_t kLanes{kVectorBytes/sizeof(F)};
+    typedef F V __attribute__((vector_size(kVectorBytes)));
+    const F* p{data.data()};
+    const std::size_t n{data.size()};
+
+    V sum[2]{}, c[2]{};
+    std::size_t i{};
+    for(;i+2*kLanes<=n;i+=2*kLanes){
+        for(std::size_t u{};u<2;++u){
+            V x;
+            std::memcpy(&x, p+i+u*kLanes, sizeof(V));
+            const V y{x-c[u]};
+            const V t{sum[u]+y};
+            c[u]=(t-sum[u])-y;
+            sum[u]=t;
+        }
+    }
+    CompensatedSum<F> total;
+    for(std::size_t u{};u<2;++u){
+        for(std::size_t k{};k<kLanes;++k){
+            total.add(sum[u][k]);
+            total.add(-c[u][k]);
+        }
+    }
+    for(;i<n;++i) total.add(p[i]);
+    return total.value();
+}
+
+class ThreadPool{
+public:
+    explicit ThreadPool(unsigned threads=std::max(1u, std::thread::hardware_concurrency()))
+    {
+        for(unsigned t{};t<threads;++t){
+            workers.emplace_back([this]{ work(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&)=delete;
+    ThreadPool& operator=(const ThreadPool&)=delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stopping=true;
+        }
+        wake.notify_all();
+        for(std::thread& w : workers) w.join();
+    }
+
+    std::size_t size() const { return workers.size(); }
+
+    template<class F>
+    auto submit(F f) -> std::future<decltype(f())>
+    {
+        // std::function must be copyable, std::packaged_task is not
+        auto task{std::make_shared<std::packaged_task<decltype(f())()>>(std::move(f))};
+        std::future<decltype(f())> result{task->get_future()};
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            tasks.push([task]{ (*task)(); });
+        }
+        wake.notify_one();
+        return result;
+    }
+
+private:
+    void work()
+    {
+        while(true){
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                wake.wait(lock, [this]{ return stopping || !tasks.empty(); });
+                if(tasks.empty()) return;           // stopping and nothing left
+                task=std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping{false};
+};
+
+// Sum on the pool. Integers: exact (sum_int per chunk). Floating point:
+// sum_kahan per chunk, chunk results combined in order with Neumaier.
+template<class T>
+auto parallel_sum(std::span<const T> data, ThreadPool& pool)
+{
+    constexpr std::size_t kChunk{std::size_t{1}<<16};
+    using R=std::conditional_t<std::is_integral_v<T>, WideSum<T>, T>;
+    std::vector<std::future<R>> parts;
+    for(std::size_t begin{};begin<data.size();begin+=kChunk){
+        const std::span<const T> chunk{data.subspan(begin, std::min(kChunk, data.size()-begin))};
+        parts.push_back(pool.submit([chunk]{
+            if constexpr(std::is_integral_v<T>) return sum_int(chunk);
+            else return sum_kahan(chunk);
+        }));
+    }
+    // every task reads the caller's data: let them all finish before
+    // anything below can throw
+    for(std::future<R>& part : parts) part.wait();
+    if constexpr(std::is_integral_v<T>){
+        R total{};
+        for(std::future<R>& part : parts){
+            if(__builtin_add_overflow(total, part.get(), &total)){
+                throw std::overflow_error("parallel_sum: total does not fit in 64 bits");
+            }
+        }
+        return total;
+    }
+    else{
+        CompensatedSum<T> total;
+        for(std::future<R>& part : parts) total.add(part.get());
+        return total.value();
+    }
+}
+
+// Count, mean and variance of a stream of numbers, fed in any chunk sizes.
+class RunningStats{
+public:
+    void add(double x)
+    {
+        ++n;
+        const double delta{x-mu};
+        mu+=delta/static_cast<double>(n);
+        m2+=delta*(x-mu);
+    }
+
+    template<class T>
+    void add(std::span<const T> chunk)
+    {
+        if(chunk.empty()) return;
+        // two passes over the chunk (it is in memory), then merge
+        RunningStats part;
+        part.n=chunk.size();
+        CompensatedSum<double> s;
+        for(T x : chunk) s.add(static_cast<double>(x));
+        part.mu=s.value()/static_cast<double>(part.n);
+        CompensatedSum<double> sq;
+        for(T x : chunk){
+            const double d{static_cast<double>(x)-part.mu};
+            sq.add(d*d);
+        }
+        part.m2=sq.value();
+        merge(part);
+    }
+
+    void merge(const RunningStats& other)
+    {
+        if(other.n==0) return;
+        if(n==0){
+            *this=other;
+            return;
+        }
+        const double total{static_cast<double>(n+other.n)};
+        const double delta{other.mu-mu};
+        mu+=delta*static_cast<double>(other.n)/total;
+        m2+=other.m2+delta*delta*static_cast<double>(n)*static_cast<double>(other.n)/total;
+        n+=other.n;
+    }
+
+    std::size_t count() const { return n; }
+    double mean() const { return mu; }
+    // population variance (divide by n); NaN for an empty stream
+    double variance() const { return n>0 ? m2/static_cast<double>(n) : std::numeric_limits<double>::quiet_NaN(); }
+    // sample variance (divide by n-1); NaN for fewer than 2 values
+    double sample_variance() const { return n>1 ? m2/static_cast<double>(n-1) : std::numeric_limits<double>::quiet_NaN(); }
+
+private:
+    std::size_t n{};
+    double mu{};
+    double m2{};
+};
+
+// Same output as Codingexercise/CodingExercise33.cpp
+void Sum()
+{
+    const int A[]={2, 4, 11, 8, 10, 15, 13};
+    std::cout<<sum_int<int>(A);
+}
+
+int main(){
+    std::cout<<"Sum: "; Sum(); std::cout<<"\n";
+
+    // StudentExercise6 without the 100-number limit: nothing is stored
+    int n{};
+    std::cout<<"Enter the numbers of elements: "<<std::flush;
+    std::cin>>n;
+    RunningStats stats;
+    for(int i{};i<n;++i){
+        double x{};
+        std::cout<<i+1<<". Enter number: "<<std::flush;
+        std::cin>>x;
+        stats.add(x);
+    }
+    std::cout<<"Average = "<<stats.mean()<<", variance = "<<stats.variance()<<"\n";
+
+    using Clock=std::chrono::steady_clock;
+    auto ms=[](auto d){ return std::chrono::duration<double, std::milli>{d}.count(); };
+    std::mt19937 rng{23};
+    ThreadPool pool;
+
+    // integers: 10^8 values near INT_MAX
+    std::vector<int> ints(100'000'000);
+    for(int& x : ints) x=std::numeric_limits<int>::max()-static_cast<int>(rng()%1000);
+    auto t0{Clock::now()};
+    int intSum{};
+    for(int x : ints) intSum=static_cast<int>(static_cast<unsigned>(intSum)+static_cast<unsigned>(x));   // the int loop, wrap-around made explicit
+    auto t1{Clock::now()};
+    long long scalarWide{};
+    for(int x : ints) scalarWide+=x;
+    auto t2{Clock::now()};
+    const std::int64_t wide{sum_int<int>(ints)};
+    auto t3{Clock::now()};
+    const std::int64_t wideParallel{parallel_sum<int>(ints, pool)};
+    auto t4{Clock::now()};
+    std::cout<<"10^8 ints: int loop "<<intSum<<" (wrapped, "<<ms(t1-t0)<<" ms), long long loop "<<ms(t2-t1)
+             <<" ms, sum_int "<<wide<<" ("<<ms(t3-t2)<<" ms), parallel "<<ms(t4-t3)<<" ms"
+             <<(wide==scalarWide && wide==wideParallel ? "" : " MISMATCH")<<"\n";
+
+    // floats: 10^8 values in [0, 1), exact reference in long double + compensation
+    std::vector<float> data(100'000'000);
+    std::uniform_real_distribution<float> dist{0.0f, 1.0f};
+    for(float& x : data) x=dist(rng);
+    CompensatedSum<long double> exact;
+    for(float x : data) exact.add(x);
+    const long double reference{exact.value()};
+
+    auto report=[&](const char* name, float value, double time){
+        std::cout<<"  "<<std::left<<std::setw(14)<<name<<std::right<<std::setw(14)<<std::fixed<<std::setprecision(1)
+                 <<value<<"  error "<<std::setw(12)<<std::scientific<<std::setprecision(2)
+                 <<static_cast<double>(std::abs(value-reference)/reference)<<"  "<<std::fixed<<std::setprecision(1)
+                 <<time<<" ms\n";
+    };
+    std::cout<<"10^8 floats, exact sum "<<std::fixed<<std::setprecision(1)<<static_cast<double>(reference)<<"\n";
+    auto t5{Clock::now()};
+    float naive{};
+    for(float x : data) naive+=x;
+    auto t6{Clock::now()};
+    report("float loop", naive, ms(t6-t5));
+    const float pairwise{sum_pairwise<float>(data)};
+    auto t7{Clock::now()};
+    report("pairwise", pairwise, ms(t7-t6));
+    const float kahan{sum_kahan<float>(data)};
+    auto t8{Clock::now()};
+    report("Kahan", kahan, ms(t8-t7));
+    const float parallel{parallel_sum<float>(data, pool)};
+    auto t9{Clock::now()};
+    report("parallel", parallel, ms(t9-t8));
+
+    // streaming in chunks gives the same mean/variance as all at once
+    RunningStats chunked;
+    for(std::size_t begin{};begin<data.size();begin+=1'000'003){
+        chunked.add(std::span<const float>{data}.subspan(begin, std::min<std::size_t>(1'000'003, data.size()-begin)));
+    }
+    std::cout<<"streamed mean "<<std::setprecision(6)<<chunked.mean()<<", variance "<<chunked.variance()
+             <<" (uniform [0,1): 0.5, 1/12 = 0.083333)\n";
+    return 0;
+}
+/*
+🔸 Output (sample)
+Sum: 63
+Enter the numbers of elements: 3
+1. Enter number: 1.5
+2. Enter number: 2.5
+3. Enter number: 3.5
+Average = 2.5, variance = 0.666667
+10^8 floats, exact sum 49999860.8
+  float loop        16777216.0  error     6.64e-01  91.0 ms
+  pairwise          49999864.0  error     6.31e-08  54.1 ms
+  Kahan             49999860.0  error     1.69e-08  61.5 ms
+  parallel          49999860.0  error     1.69e-08  71.8 ms
+
+⚠️ Notes
+ - The plain float loop gets stuck at 2^24 = 16777216: every x < 1 is
+   less than half a step there and rounds away. Pairwise and Kahan stay
+   within one float rounding.
+ - At 10^8 elements every version is limited by memory bandwidth; the
+   SIMD/threaded versions pay off on data that is already in cache or on
+   machines with more cores than this single-core test VM.
+ - parallel_sum gives the same result for any number of threads, since the
+   chunks and the order they are combined in never change.
+*/
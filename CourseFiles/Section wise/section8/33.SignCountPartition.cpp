@@ -0,0 +1,376 @@
+/*
+➕➖ Counting and separating negatives without branches
+15.PositiveAndNegativeElementsinArray.cpp and Codingexercise/CodingExercise36.cpp
+test every element with if(x<0). On random data (sensor deltas go up and
+down) the branch predictor guesses wrong about half the time, ~15 cycles each.
+
+🔹 Counting with sign-bit masks and popcount
+A SIMD compare gives a mask with one bit per lane:
+    v          :  3  -2   0   9  -4  10   0  -7
+    v < 0      :  0   1   0   0   1   0   0   1   → popcount = 3 negatives
+    v == 0     :  0   0   1   0   0   0   1   0   → popcount = 2 zeros
+    positives  =  8 - 3 - 2 = 3
+    AVX2   : _mm256_cmpgt_epi32 + movemask (one bit per int) + std::popcount
+    AVX-512: _mm512_cmplt_epi32_mask gives the bit mask directly
+    scalar : negatives += x>>31 & 1 (the sign bit), zeros += (x==0), no if
+
+🔹 Stable partition with vector compress
+"Compress" packs the lanes selected by a mask to the front of a register,
+keeping their order:
+    v     :  3  -2   0   9  -4  10   0  -7
+    mask  :  0   1   0   0   1   0   0   1
+    packed: -2  -4  -7   ?   ?   ?   ?   ?     → store, advance by 3
+ - AVX-512 has it as one instruction (vpcompressd).
+ - AVX2 does not; a 256-entry table gives, for every 8-bit mask, the lane
+   order for _mm256_permutevar8x32_epi32 that does the same job.
+ - scalar: write x to BOTH outputs and advance only the right one.
+Negatives and non-negatives both keep their original order (stable).
+
+partition_copy writes into two caller buffers. partition_in_place compacts
+the negatives to the front of the array itself (the write position never
+passes the read position) and only the non-negatives go through a scratch
+buffer.
+*/
+
+#include <iostream>
+#include <vector>
+#include <span>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <chrono>
+#include <random>
+#include <iomanip>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+enum class Isa{ Scalar, AVX2, AVX512 };
+
+std::string isaName(Isa isa)
+{
+    switch(isa){
+        case Isa::AVX2: return "AVX2";
+        case Isa::AVX512: return "AVX-512";
+        default: return "scalar";
+    }
+}
+
+Isa detect_isa()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) return Isa::AVX512;
+    if(__builtin_cpu_supports("avx2")) return Isa::AVX2;
+#endif
+    return Isa::Scalar;
+}
+
+struct SignCounts{
+    std::size_t negative{};
+    std::size_t zero{};
+    std::size_t positive{};
+
+    bool operator==(const SignCounts&) const=default;
+};
+
+// ---------- scalar, branchless ----------
+SignCounts countScalar(const std::int32_t* p, std::size_t n)
+{
+    std::size_t negative{}, zero{};
+    for(std::size_t i{};i<n;++i){
+        negative+=static_cast<std::uint32_t>(p[i])>>31;
+        zero+=(p[i]==0);
+    }
+    return {negative, zero, n-negative-zero};
+}
+
+std::size_t partitionScalar(const std::int32_t* in, std::size_t n, std::int32_t* negatives, std::int32_t* others)
+{
+    std::size_t neg{}, pos{};
+    for(std::size_t i{};i<n;++i){
+        const std::int32_t x{in[i]};
+        const std::size_t isNegative{static_cast<std::uint32_t>(x)>>31};
+        negatives[neg]=x;           // both stores always happen,
+        others[pos]=x;              // only one position moves on
+        neg+=isNegative;
+        pos+=1-isNegative;
+    }
+    return neg;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// ---------- AVX2 ----------
+__attribute__((target("avx2"))) SignCounts countAVX2(const std::int32_t* p, std::size_t n)
+{
+    const __m256i zeroVec{_mm256_setzero_si256()};
+    std::size_t negative{}, zero{};
+    std::size_t i{};
+    for(;i+8<=n;i+=8){
+        const __m256i v{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p+i))};
+        // movemask_ps takes the top (sign) bit of each 32-bit lane directly
+        const unsigned negMask{static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(v)))};
+        const unsigned zeroMask{static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, zeroVec))))};
+        negative+=std::popcount(negMask);
+        zero+=std::popcount(zeroMask);
+    }
+    const SignCounts tail{countScalar(p+i, n-i)};
+    negative+=tail.negative;
+    zero+=tail.zero;
+    return {negative, zero, n-negative-zero};
+}
+
+// kCompress[m] = lane indices of the set bits of m first, in order
+constexpr auto kCompress=[]{
+    std::array<std::array<std::int32_t, 8>, 256> table{};
+    for(int mask{};mask<256;++mask){
+        int k{};
+        for(int lane{};lane<8;++lane){
+            if(mask&(1<<lane)) table[mask][k++]=lane;
+        }
+        for(int lane{};lane<8;++lane){      // unused slots: anything valid
+            if(!(mask&(1<<lane))) table[mask][k++]=lane;
+        }
+    }
+    return table;
+}();
+
+__attribute__((target("avx2"))) std::size_t partitionAVX2(const std::int32_t* in, std::size_t n,
+                                                          std::int32_t* negatives, std::int32_t* others)
+{
+    std::size_t neg{}, pos{};
+    std::size_t i{};
+    for(;i+8<=n;i+=8){
+        const __m256i v{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in+i))};
+        const unsigned negMask{static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(v)))};
+        const unsigned posMask{~negMask&0xFFu};
+        const __m256i negOrder{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(kCompress[negMask].data()))};
+        const __m256i posOrder{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(kCompress[posMask].data()))};
+        // full 8-lane stores: the lanes past the count are overwritten later
+        // and never go past in+i+8 <= n, so the buffers need no extra room
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(negatives+neg), _mm256_permutevar8x32_epi32(v, negOrder));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(others+pos), _mm256_permutevar8x32_epi32(v, posOrder));
+        neg+=std::popcount(negMask);
+        pos+=std::popcount(posMask);
+    }
+    return neg+partitionScalar(in+i, n-i, negatives+neg, others+pos);
+}
+
+// ---------- AVX-512 ----------
+__attribute__((target("avx512f"))) SignCounts countAVX512(const std::int32_t* p, std::size_t n)
+{
+    const __m512i zeroVec{_mm512_setzero_si512()};
+    std::size_t negative{}, zero{};
+    std::size_t i{};
+    for(;i+16<=n;i+=16){
+        const __m512i v{_mm512_loadu_si512(p+i)};
+        negative+=std::popcount(static_cast<unsigned>(_mm512_cmplt_epi32_mask(v, zeroVec)));
+        zero+=std::popcount(static_cast<unsigned>(_mm512_cmpeq_epi32_mask(v, zeroVec)));
+    }
+    const SignCounts tail{countScalar(p+i, n-i)};
+    negative+=tail.negative;
+    zero+=tail.zero;
+    return {negative, zero, n-negative-zero};
+}
+
+__attribute__((target("avx512f"))) std::size_t partitionAVX512(const std::int32_t* in, std::size_t n,
+                                                              std::int32_t* negatives, std::int32_t* others)
+{
+    const __m512i zeroVec{_mm512_setzero_si512()};
+    std::size_t neg{}, pos{};
+    std::size_t i{};
+    for(;i+16<=n;i+=16){
+        const __m512i v{_mm512_loadu_si512(in+i)};
+        const __mmask16 negMask{_mm512_cmplt_epi32_mask(v, zeroVec)};
+        const __mmask16 posMask{static_cast<__mmask16>(~negMask)};
+        // compress in a register + full store is faster than compressstoreu
+        _mm512_storeu_si512(negatives+neg, _mm512_maskz_compress_epi32(negMask, v));
+        _mm512_storeu_si512(others+pos, _mm512_maskz_compress_epi32(posMask, v));
+        neg+=std::popcount(static_cast<unsigned>(negMask));
+        pos+=std::popcount(static_cast<unsigned>(posMask));
+    }
+    return neg+partitionScalar(in+i, n-i, negatives+neg, others+pos);
+}
+
+#endif
+
+using CountFunction=SignCounts(*)(const std::int32_t*, std::size_t);
+using PartitionFunction=std::size_t(*)(const std::int32_t*, std::size_t, std::int32_t*, std::int32_t*);
+
+CountFunction count_kernel(Isa isa)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if(isa==Isa::AVX512) return &countAVX512;
+    if(isa==Isa::AVX2) return &countAVX2;
+#endif
+    (void)isa;
+    return &countScalar;
+}
+
+PartitionFunction partition_kernel(Isa isa)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if(isa==Isa::AVX512) return &partitionAVX512;
+    if(isa==Isa::AVX2) return &partitionAVX2;
+#endif
+    (void)isa;
+    return &partitionScalar;
+}
+
+SignCounts count_signs(std::span<const std::int32_t> data)
+{
+    static const CountFunction kernel{count_kernel(detect_isa())};
+    return kernel(data.data(), data.size());
+}
+
+// Negatives → negatives[0..k), the rest → others[0..size-k), both in their
+// original order. Returns k. Both buffers need room for data.size() values
+// and must not overlap data.
+std::size_t partition_copy(std::span<const std::int32_t> data, std::span<std::int32_t> negatives,
+                           std::span<std::int32_t> others)
+{
+    if(negatives.size()<data.size() || others.size()<data.size()){
+        throw std::invalid_argument("partition_copy: output buffers must hold data.size() values");
+    }
+    static const PartitionFunction kernel{partition_kernel(detect_isa())};
+    return kernel(data.data(), data.size(), negatives.data(), others.data());
+}
+
+// Stable in-place version: negatives first, then the rest. Returns the
+// number of negatives.
+std::size_t partition_in_place(std::span<std::int32_t> data)
+{
+    static const PartitionFunction kernel{partition_kernel(detect_isa())};
+    std::vector<std::int32_t> others(data.size());
+    // the kernel writes negatives at or before the position it reads, and
+    // every block is loaded before it is stored, so in == negatives is safe
+    const std::size_t negatives{kernel(data.data(), data.size(), data.data(), others.data())};
+    std::copy_n(others.begin(), data.size()-negatives, data.begin()+static_cast<std::ptrdiff_t>(negatives));
+    return negatives;
+}
+
+// Same output as Codingexercise/CodingExercise36.cpp (zero counts as positive there)
+void Count()
+{
+    const std::int32_t A[]={3, 5, -2, 9, -4, 10, -24, 19, 81, -7, 12, 13};
+    const SignCounts c{count_signs(A)};
+    std::cout<<c.positive+c.zero<<" "<<c.negative;
+}
+
+int main(){
+    std::cout<<"Count(): "; Count(); std::cout<<"\n";
+
+    std::vector<std::int32_t> A{3, 5, -2, 9, -4, 10, -24, 19, 81, -7, 12, 0, 13};
+    const SignCounts c{count_signs(A)};
+    std::cout<<"negative "<<c.negative<<", zero "<<c.zero<<", positive "<<c.positive<<"\n";
+    const std::size_t k{partition_in_place(A)};
+    std::cout<<"partitioned ("<<k<<" negatives):";
+    for(std::int32_t x : A) std::cout<<" "<<x;
+    std::cout<<"\n";
+
+    const Isa best{detect_isa()};
+    std::cout<<"CPU supports: "<<isaName(best)<<"\n";
+
+    // 10^7 sensor deltas: random sign, about 5% zeros
+    std::mt19937 rng{29};
+    std::vector<std::int32_t> deltas(10'000'000);
+    for(std::int32_t& d : deltas){
+        d=static_cast<std::int32_t>(rng()%2001)-1000;
+        if(rng()%20==0) d=0;
+    }
+
+    // every kernel against the branchy loop and std::stable_partition
+    bool ok{true};
+    for(std::size_t n : {std::size_t{0}, std::size_t{5}, std::size_t{31}, std::size_t{1000}}){
+        std::span<const std::int32_t> part{deltas.data(), n};
+        SignCounts expected;
+        for(std::int32_t x : part){
+            if(x<0) ++expected.negative;
+            else if(x==0) ++expected.zero;
+            else ++expected.positive;
+        }
+        std::vector<std::int32_t> reference(part.begin(), part.end());
+        std::stable_partition(reference.begin(), reference.end(), [](std::int32_t x){ return x<0; });
+        for(int isa{};isa<=static_cast<int>(best);++isa){
+            ok=ok && count_kernel(static_cast<Isa>(isa))(part.data(), n)==expected;
+            std::vector<std::int32_t> neg(n), rest(n);
+            const std::size_t m{partition_kernel(static_cast<Isa>(isa))(part.data(), n, neg.data(), rest.data())};
+            ok=ok && m==expected.negative && std::equal(neg.begin(), neg.begin()+static_cast<std::ptrdiff_t>(m), reference.begin())
+                  && std::equal(rest.begin(), rest.begin()+static_cast<std::ptrdiff_t>(n-m), reference.begin()+static_cast<std::ptrdiff_t>(m));
+        }
+    }
+    std::cout<<"all kernels match: "<<(ok ? "yes" : "NO")<<"\n";
+
+    using Clock=std::chrono::steady_clock;
+    auto ms=[](auto d){ return std::chrono::duration<double, std::milli>{d}.count(); };
+    std::cout<<std::fixed<<std::setprecision(1);
+
+    auto t0{Clock::now()};
+    std::size_t pcount{}, ncount{};
+    for(std::int32_t x : deltas){
+        if(x<0) ++ncount;
+        else ++pcount;
+    }
+    std::cout<<"count, if-loop        : "<<ms(Clock::now()-t0)<<" ms ("<<ncount<<" negatives)\n";
+    for(int isa{};isa<=static_cast<int>(best);++isa){
+        auto t1{Clock::now()};
+        const SignCounts s{count_kernel(static_cast<Isa>(isa))(deltas.data(), deltas.size())};
+        std::cout<<"count, "<<std::left<<std::setw(15)<<isaName(static_cast<Isa>(isa))<<std::right<<": "
+                 <<ms(Clock::now()-t1)<<" ms"<<(s.negative==ncount ? "" : " MISMATCH")<<"\n";
+    }
+
+    std::vector<std::int32_t> neg(deltas.size()), rest(deltas.size());
+    std::vector<std::int32_t> copy{deltas};
+    auto t2{Clock::now()};
+    std::stable_partition(copy.begin(), copy.end(), [](std::int32_t x){ return x<0; });
+    std::cout<<"std::stable_partition : "<<ms(Clock::now()-t2)<<" ms\n";
+    auto t3{Clock::now()};
+    std::size_t nn{}, nr{};
+    for(std::int32_t x : deltas){
+        if(x<0) neg[nn++]=x;
+        else rest[nr++]=x;
+    }
+    std::cout<<"partition, if-loop    : "<<ms(Clock::now()-t3)<<" ms\n";
+    for(int isa{};isa<=static_cast<int>(best);++isa){
+        auto t4{Clock::now()};
+        partition_kernel(static_cast<Isa>(isa))(deltas.data(), deltas.size(), neg.data(), rest.data());
+        std::cout<<"partition, "<<std::left<<std::setw(11)<<isaName(static_cast<Isa>(isa))<<std::right<<": "
+                 <<ms(Clock::now()-t4)<<" ms\n";
+    }
+    return 0;
+}
+/*
+🔸 Output (sample)
+Count(): 8 4
+negative 4, zero 1, positive 8
+partitioned (4 negatives): -2 -4 -24 -7 3 5 9 10 19 81 12 0 13
+CPU supports: AVX-512
+all kernels match: yes
+count, if-loop        : 11.2 ms (4744554 negatives)
+count, scalar         : 14.7 ms
+count, AVX2           : 7.0 ms
+count, AVX-512        : 6.1 ms
+std::stable_partition : 71.7 ms
+partition, if-loop    : 57.6 ms
+partition, scalar     : 13.2 ms
+partition, AVX2       : 7.5 ms
+partition, AVX-512    : 7.1 ms
+
+⚠️ Notes
+ - The if-loop COUNT is already fast: with only ++ in each branch the
+   compiler turns it into branch-free code by itself. The partition has a
+   store in each branch, which it cannot do, and there the mispredictions
+   cost ~8x. At 10^7 ints (40 MB) AVX2 and AVX-512 are both limited by
+   memory bandwidth.
+ - Zero is neither negative nor positive in SignCounts; Count() adds the
+   zeros to the positives to keep the exercise's output.
+ - Only int32_t is handled: the sign bit trick for floats would count -0.0
+   as negative and NaNs by their sign bit, which needs its own rules.
+*/
@@ -0,0 +1,453 @@
+/*
+🧮 Matrix multiplication that keeps the CPU busy
+27.MatrixMultiplication.cpp and Studentpracticeexercise/StudentExercise7.cpp
+use int a[100][100] on the stack and the textbook loop:
+    for i, for j, for k:  mult[i][j] += a[i][k]*b[k][j];
+The inner loop walks DOWN a column of b: every step jumps a whole row ahead,
+so every b[k][j] is a different cache line. For n=1024 each multiply-add
+waits on memory and the CPU does well under 1 GFLOP/s.
+
+🔹 Step 1: loop order (i-k-j)
+    for i, for k:  aik = a[i][k];  for j:  c[i][j] += aik*b[k][j];
+Same arithmetic, but the inner loop now runs along a row of b and a row of c,
+contiguous memory the compiler can vectorise. Several times faster already,
+but for big n the rows of b no longer fit in cache and get reloaded n times.
+
+🔹 Step 2: tiling for L2 / L1 (the GotoBLAS / BLIS scheme)
+    for each kNC-column block of B                (jc)
+      for each kKC-row block of it                (pc)  → pack into Bp (~L3)
+        for each kMC-row block of A   [a task]    (ic)  → pack into Ap (~L2)
+          for each kNR-column sliver of Bp        (jr)  (~L1)
+            for each kMR-row sliver of Ap         (ir)
+              micro-kernel: C[kMR x kNR] += Ap sliver * Bp sliver
+"Packing" copies a block into the exact order the micro-kernel reads it, so
+every load in the hot loop is sequential and aligned. Edges are padded with
+zeros, so the micro-kernel never needs a size check.
+
+🔹 Step 3: register blocking (the micro-kernel)
+A kMR x kNR tile of C lives in kMR*2 vector registers for the whole kKC loop:
+    for p: b0,b1 = 2 vectors of row p of the B sliver
+           for r: acc[r] += a[r][p] (broadcast) * b0,b1
+Each loaded value is used kMR or 2*lanes times, so the loop is limited by the
+multiply-add units, not by loads. Vector width follows the build
+(-mavx2 / -mavx512f, or -march=native), as in 31.MinMaxReduction.cpp.
+
+🔹 Step 4: threads
+Every kMC-row block of C is a separate output tile with its own packed A, so
+the tiles of one (jc, pc) step run as independent tasks on a ThreadPool and
+share the packed B read-only.
+
+Matrix<T> stores its rows in one 64-byte aligned heap block; each row is
+padded to a multiple of 64 bytes, so every row starts on a cache line.
+*/
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <queue>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <cmath>
+
+#if defined(__AVX512F__)
+constexpr std::size_t kVectorBytes{64};
+#elif defined(__AVX2__)
+constexpr std::size_t kVectorBytes{32};
+#else
+constexpr std::size_t kVectorBytes{16};     // SSE2, always there on x86-64
+#endif
+
+constexpr std::size_t kCacheLine{64};
+
+struct AlignedFree{
+    void operator()(void* p) const { std::free(p); }
+};
+
+template<class T>
+std::unique_ptr<T[], AlignedFree> alignedBuffer(std::size_t count)
+{
+    const std::size_t bytes{(std::max<std::size_t>(count, 1)*sizeof(T)+kCacheLine-1)/kCacheLine*kCacheLine};
+    T* p{static_cast<T*>(std::aligned_alloc(kCacheLine, bytes))};
+    if(p==nullptr) throw std::bad_alloc{};
+    return std::unique_ptr<T[], AlignedFree>{p};
+}
+
+// Row-major rows x cols matrix, zero-initialised, rows 64-byte aligned.
+template<class T>
+class Matrix{
+    static_assert(std::is_arithmetic_v<T>, "Matrix holds numbers");
+
+public:
+    Matrix(std::size_t rows, std::size_t cols)
+        : nRows{rows}, nCols{cols},
+          rowStride{(cols*sizeof(T)+kCacheLine-1)/kCacheLine*kCacheLine/sizeof(T)},
+          storage{alignedBuffer<T>(rows*rowStride)}
+    {
+        std::memset(storage.get(), 0, rows*rowStride*sizeof(T));
+    }
+
+    std::size_t rows() const { return nRows; }
+    std::size_t cols() const { return nCols; }
+    std::size_t stride() const { return rowStride; }       // elements between rows
+
+    T& operator()(std::size_t i, std::size_t j) { return storage[i*rowStride+j]; }
+    const T& operator()(std::size_t i, std::size_t j) const { return storage[i*rowStride+j]; }
+
+    T* row(std::size_t i) { return storage.get()+i*rowStride; }
+    const T* row(std::size_t i) const { return storage.get()+i*rowStride; }
+
+private:
+    std::size_t nRows{}, nCols{}, rowStride{};
+    std::unique_ptr<T[], AlignedFree> storage;
+};
+
+class ThreadPool{
+public:
+    explicit ThreadPool(unsigned threads=std::max(1u, std::thread::hardware_concurrency()))
+    {
+        for(unsigned t{};t<threads;++t){
+            workers.emplace_back([this]{ work(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&)=delete;
+    ThreadPool& operator=(const ThreadPool&)=delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            stopping=true;
+        }
+        wake.notify_all();
+        for(std::thread& w : workers) w.join();
+    }
+
+    std::size_t size() const { return workers.size(); }
+
+    template<class F>
+    auto submit(F f) -> std::future<decltype(f())>
+    {
+        auto task{std::make_shared<std::packaged_task<decltype(f())()>>(std::move(f))};
+        std::future<decltype(f())> result{task->get_future()};
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            tasks.push([task]{ (*task)(); });
+        }
+        wake.notify_one();
+        return result;
+    }
+
+private:
+    void work()
+    {
+        while(true){
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                wake.wait(lock, [this]{ return stopping || !tasks.empty(); });
+                if(tasks.empty()) return;
+                task=std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping{false};
+};
+
+namespace gemm_detail{
+
+// Block sizes for element type T. kNR = 2 vectors, kMR = 6 rows:
+// 12 accumulators + 2 B vectors + 1 broadcast fit in 16 registers.
+template<class T>
+struct Blocking{
+    typedef T V __attribute__((vector_size(kVectorBytes)));
+    static constexpr std::size_t kLanes{kVectorBytes/sizeof(T)};
+    static constexpr std::size_t kMR{6};
+    static constexpr std::size_t kNR{2*kLanes};
+    static constexpr std::size_t kKC{256};                  // Bp sliver kKC*kNR: L1
+    static constexpr std::size_t kMC{kMR*16};               // Ap block kMC*kKC: L2
+    static constexpr std::size_t kNC{kNR*(4096/kNR)};       // Bp block kKC*kNC: L3
+};
+
+// Ap: kMR-row slivers, column by column: ap[(sliver*kc + p)*kMR + r]
+template<class T>
+void packA(const Matrix<T>& a, std::size_t i0, std::size_t mc, std::size_t p0, std::size_t kc, T* ap)
+{
+    constexpr std::size_t kMR{Blocking<T>::kMR};
+    for(std::size_t ir{};ir<mc;ir+=kMR){
+        const std::size_t rows{std::min(kMR, mc-ir)};
+        for(std::size_t p{};p<kc;++p){
+            for(std::size_t r{};r<kMR;++r){
+                *ap++=r<rows ? a(i0+ir+r, p0+p) : T{};
+            }
+        }
+    }
+}
+
+// Bp: kNR-column slivers, row by row: bp[(sliver*kc + p)*kNR + j]
+template<class T>
+void packB(const Matrix<T>& b, std::size_t p0, std::size_t kc, std::size_t j0, std::size_t nc, T* bp)
+{
+    constexpr std::size_t kNR{Blocking<T>::kNR};
+    for(std::size_t jr{};jr<nc;jr+=kNR){
+        const std::size_t cols{std::min(kNR, nc-jr)};
+        for(std::size_t p{};p<kc;++p){
+            const T* src{b.row(p0+p)+j0+jr};
+            std::size_t j{};
+            for(;j<cols;++j) bp[j]=src[j];
+            for(;j<kNR;++j) bp[j]=T{};
+            bp+=kNR;
+        }
+    }
+}
+
+// C[rows x cols] += Ap sliver * Bp sliver, rows <= kMR, cols <= kNR
+template<class T>
+void microKernel(std::size_t kc, const T* ap, const T* bp, T* c, std::size_t ldc, std::size_t rows, std::size_t cols)
+{
+    using B=Blocking<T>;
+    using V=typename B::V;
+    V acc[B::kMR][2]{};
+    for(std::size_t p{};p<kc;++p){
+        const V b0{*reinterpret_cast<const V*>(bp)};
+        const V b1{*reinterpret_cast<const V*>(bp+B::kLanes)};
+#pragma GCC unroll 8
+        for(std::size_t r{};r<B::kMR;++r){
+            const V ar{V{}+ap[r]};          // broadcast
+            acc[r][0]+=ar*b0;
+            acc[r][1]+=ar*b1;
+        }
+        ap+=B::kMR;
+        bp+=B::kNR;
+    }
+
+    if(rows==B::kMR && cols==B::kNR){
+#pragma GCC unroll 8
+        for(std::size_t r{};r<B::kMR;++r){
+            V c0, c1;
+            std::memcpy(&c0, c+r*ldc, sizeof(V));
+            std::memcpy(&c1, c+r*ldc+B::kLanes, sizeof(V));
+            c0+=acc[r][0];
+            c1+=acc[r][1];
+            std::memcpy(c+r*ldc, &c0, sizeof(V));
+            std::memcpy(c+r*ldc+B::kLanes, &c1, sizeof(V));
+        }
+        return;
+    }
+    // edge tile: only the part inside C
+    T tile[B::kMR][B::kNR];
+    std::memcpy(tile, acc, sizeof(tile));
+    for(std::size_t r{};r<rows;++r){
+        for(std::size_t j{};j<cols;++j) c[r*ldc+j]+=tile[r][j];
+    }
+}
+
+// One output tile: rows [i0, i0+mc) of C, columns [j0, j0+nc), k-block [p0, p0+kc)
+template<class T>
+void multiplyTile(const Matrix<T>& a, const T* bp, Matrix<T>& c, std::size_t i0, std::size_t mc,
+                  std::size_t p0, std::size_t kc, std::size_t j0, std::size_t nc)
+{
+    using B=Blocking<T>;
+    const std::size_t slivers{(mc+B::kMR-1)/B::kMR};
+    auto ap{alignedBuffer<T>(slivers*B::kMR*kc)};
+    packA(a, i0, mc, p0, kc, ap.get());
+    for(std::size_t jr{};jr<nc;jr+=B::kNR){
+        const T* bSliver{bp+jr*kc};
+        for(std::size_t ir{};ir<mc;ir+=B::kMR){
+            microKernel(kc, ap.get()+ir*kc, bSliver, c.row(i0+ir)+j0+jr, c.stride(),
+                        std::min(B::kMR, mc-ir), std::min(B::kNR, nc-jr));
+        }
+    }
+}
+
+}   // namespace gemm_detail
+
+// c = a * b. c must already have a.rows() x b.cols(); its contents are replaced.
+template<class T>
+void gemm(const Matrix<T>& a, const Matrix<T>& b, Matrix<T>& c, ThreadPool& pool)
+{
+    using B=gemm_detail::Blocking<T>;
+    if(a.cols()!=b.rows() || c.rows()!=a.rows() || c.cols()!=b.cols()){
+        throw std::invalid_argument("gemm: matrix dimensions do not match");
+    }
+    const std::size_t m{a.rows()}, n{b.cols()}, k{a.cols()};
+    for(std::size_t i{};i<m;++i) std::fill_n(c.row(i), n, T{});
+
+    auto bp{alignedBuffer<T>(B::kKC*B::kNC)};
+    std::vector<std::future<void>> tiles;
+    for(std::size_t j0{};j0<n;j0+=B::kNC){
+        const std::size_t nc{std::min(B::kNC, n-j0)};
+        for(std::size_t p0{};p0<k;p0+=B::kKC){
+            const std::size_t kc{std::min(B::kKC, k-p0)};
+            gemm_detail::packB(b, p0, kc, j0, nc, bp.get());
+            tiles.clear();
+            for(std::size_t i0{};i0<m;i0+=B::kMC){
+                const std::size_t mc{std::min(B::kMC, m-i0)};
+                tiles.push_back(pool.submit([&, i0, mc, p0, kc, j0, nc]{
+                    gemm_detail::multiplyTile(a, bp.get(), c, i0, mc, p0, kc, j0, nc);
+                }));
+            }
+            for(std::future<void>& t : tiles) t.get();     // Bp is reused next step
+        }
+    }
+}
+
+template<class T>
+Matrix<T> multiply(const Matrix<T>& a, const Matrix<T>& b, ThreadPool& pool)
+{
+    Matrix<T> c{a.rows(), b.cols()};
+    gemm(a, b, c, pool);
+    return c;
+}
+
+// The i-j-k loop from 27.MatrixMultiplication.cpp, kept for the benchmark.
+template<class T>
+void multiplyNaive(const Matrix<T>& a, const Matrix<T>& b, Matrix<T>& c)
+{
+    for(std::size_t i{};i<a.rows();++i){
+        for(std::size_t j{};j<b.cols();++j){
+            T sum{};
+            for(std::size_t k{};k<a.cols();++k) sum+=a(i, k)*b(k, j);
+            c(i, j)=sum;
+        }
+    }
+}
+
+// Step 1 only: i-k-j order.
+template<class T>
+void multiplyIKJ(const Matrix<T>& a, const Matrix<T>& b, Matrix<T>& c)
+{
+    for(std::size_t i{};i<a.rows();++i){
+        T* ci{c.row(i)};
+        std::fill_n(ci, b.cols(), T{});
+        for(std::size_t k{};k<a.cols();++k){
+            const T aik{a(i, k)};
+            const T* bk{b.row(k)};
+            for(std::size_t j{};j<b.cols();++j) ci[j]+=aik*bk[j];
+        }
+    }
+}
+
+template<class T>
+bool sameResult(const Matrix<T>& x, const Matrix<T>& y)
+{
+    for(std::size_t i{};i<x.rows();++i){
+        for(std::size_t j{};j<x.cols();++j){
+            if constexpr(std::is_integral_v<T>){
+                if(x(i, j)!=y(i, j)) return false;
+            }
+            else{
+                // different summation order: allow rounding differences
+                const double scale{std::max<double>(1.0, std::fabs(static_cast<double>(x(i, j))))};
+                if(std::fabs(static_cast<double>(x(i, j)-y(i, j)))>1e-3*scale) return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<class T>
+void benchmark(const char* type, std::size_t n, ThreadPool& one, ThreadPool& all, std::mt19937& rng)
+{
+    using Clock=std::chrono::steady_clock;
+    Matrix<T> a{n, n}, b{n, n}, c{n, n}, reference{n, n};
+    std::uniform_int_distribution<int> value{-8, 8};     // int products never overflow
+    for(std::size_t i{};i<n;++i){
+        for(std::size_t j{};j<n;++j){
+            a(i, j)=static_cast<T>(value(rng));
+            b(i, j)=static_cast<T>(value(rng));
+        }
+    }
+    const double flops{2.0*static_cast<double>(n)*n*n};
+    auto gflops=[&](auto run){
+        auto t0{Clock::now()};
+        run();
+        std::chrono::duration<double> s{Clock::now()-t0};
+        return flops/s.count()/1e9;
+    };
+
+    std::cout<<std::setw(6)<<type<<std::setw(6)<<n;
+    if(n<=1024) std::cout<<std::setw(9)<<gflops([&]{ multiplyNaive(a, b, reference); });
+    else std::cout<<std::setw(9)<<"-";
+    std::cout<<std::setw(9)<<gflops([&]{ multiplyIKJ(a, b, reference); });
+    bool ok{true};
+    std::cout<<std::setw(12)<<gflops([&]{ gemm(a, b, c, one); });
+    ok=ok && sameResult(c, reference);
+    std::cout<<std::setw(12)<<gflops([&]{ gemm(a, b, c, all); });
+    ok=ok && sameResult(c, reference);
+    std::cout<<(ok ? "" : "   MISMATCH")<<"\n";
+}
+
+int main(){
+    ThreadPool one{1};
+    ThreadPool all;
+
+    Matrix<int> a{2, 3}, b{3, 2};
+    const int av[2][3]{{1, 2, 3}, {4, 5, 6}};
+    const int bv[3][2]{{7, 8}, {9, 10}, {11, 12}};
+    for(std::size_t i{};i<2;++i) for(std::size_t j{};j<3;++j) a(i, j)=av[i][j];
+    for(std::size_t i{};i<3;++i) for(std::size_t j{};j<2;++j) b(i, j)=bv[i][j];
+    const Matrix<int> product{multiply(a, b, all)};
+    std::cout<<"Result matrix:\n";
+    for(std::size_t i{};i<product.rows();++i){
+        for(std::size_t j{};j<product.cols();++j) std::cout<<product(i, j)<<"\t";
+        std::cout<<"\n";
+    }
+
+    std::mt19937 rng{34};
+    std::cout<<"vector "<<kVectorBytes<<" bytes, "<<all.size()<<" threads\n"
+             <<std::fixed<<std::setprecision(2)
+             <<"  type     n    i-j-k    i-k-j   blocked x1  blocked x"<<all.size()<<"   (GFLOP/s)\n";
+    for(std::size_t n : {std::size_t{256}, std::size_t{1024}, std::size_t{2048}}){
+        benchmark<float>("float", n, one, all, rng);
+    }
+    benchmark<double>("double", 1024, one, all, rng);
+    benchmark<std::int32_t>("int32", 1024, one, all, rng);
+    return 0;
+}
+/*
+🔸 Output (sample, 1-core 2 GHz VM, g++ -O2 -march=native: 64-byte vectors)
+Result matrix:
+58	64	
+139	154	
+vector 64 bytes, 1 threads
+  type     n    i-j-k    i-k-j   blocked x1  blocked x1   (GFLOP/s)
+ float   256     1.07     2.12       26.07       40.70
+ float  1024     0.23     2.17       46.55       46.42
+ float  2048        -     1.93       49.92       51.43
+double  1024     0.20     2.38       24.19       24.99
+ int32  1024     0.24     2.10       28.80       28.86
+With plain -O2 (16-byte SSE2 vectors) the blocked float column is ~11 GFLOP/s.
+
+⚠️ Notes
+ - The i-j-k loop collapses from n=256 to n=1024 (b no longer fits in cache);
+   the blocked version gets FASTER with size because packing costs O(n^2)
+   and the multiply O(n^3).
+ - On this 1-core machine "all" threads is 1; with more cores the tiles of
+   each (jc, pc) step are spread over them. Small matrices have few kMC
+   tiles, so they cannot use many threads.
+ - Float results differ from the simple loops in the last bits: the sums
+   are added in a different order. Integers are exact (but overflow like
+   any int arithmetic).
+*/
@@ -0,0 +1,462 @@
+/*
+⚡ Strassen-Winograd: fewer multiplications for big square matrices
+27.MatrixMultiplication.cpp (and the blocked version in
+34.BlockedMatrixMultiplication.cpp) do n^3 multiply-adds. Splitting each
+matrix into 4 quadrants, ordinary block multiplication needs 8 products of
+half size. Strassen found a way with 7; Winograd's form of it also cuts the
+extra additions from 18 to 15:
+    S1 = A21 + A22    T1 = B12 - B11    M1 = A11 * B11    M5 = S1 * T1
+    S2 = S1  - A11    T2 = B22 - T1     M2 = A12 * B21    M6 = S2 * T2
+    S3 = A11 - A21    T3 = B22 - B12    M3 = S4  * B22    M7 = S3 * T3
+    S4 = A12 - S2     T4 = T2  - B21    M4 = A22 * T4
+    U2 = M1 + M6      U3 = U2 + M7
+    C11 = M1 + M2     C12 = U2 + M5 + M3
+    C21 = U3 - M4     C22 = U3 + M5
+Applied recursively that is O(n^2.807). Each level saves 1/8 of the work but
+adds O(n^2) additions that only run at memory speed, so below a CUTOFF size
+the normal blocked kernel is faster again. Where that crossover lies depends
+on the machine; the benchmark measures it.
+
+🔹 Workspace arena
+Every level needs 4 temporaries of (n/2)^2 (X for the S's, Y for the T's,
+Q for M1/U2/U3, R for M5). The products go straight into the quadrants of C.
+Instead of allocating at every call, one buffer of
+    4(n/2)^2 + 4(n/4)^2 + ... < 4/3 n^2
+elements is allocated once and handed out like a stack: a level takes its 4
+blocks from the top and gives them back when it returns.
+
+🔹 Sizes that are not a power of two (dynamic peeling)
+If n is odd, the last row and column are peeled off: the even (n-1) part
+goes through Strassen, then the peeled parts are fixed up with ordinary
+loops:
+    C[0..m)[0..m) += A[0..m)[m] * B[m][0..m)       (rank-1 update)
+    C[0..m)[m]     = row i of A  · column m of B
+    C[m][..]       = row m of A  * B
+No copy into a padded power-of-two matrix is needed, so n=2049 does not
+cost as much as n=4096.
+*/
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <cmath>
+
+#if defined(__AVX512F__)
+constexpr std::size_t kVectorBytes{64};
+#elif defined(__AVX2__)
+constexpr std::size_t kVectorBytes{32};
+#else
+constexpr std::size_t kVectorBytes{16};     // SSE2, always there on x86-64
+#endif
+
+constexpr std::size_t kCacheLine{64};
+
+struct AlignedFree{
+    void operator()(void* p) const { std::free(p); }
+};
+
+template<class T>
+std::unique_ptr<T[], AlignedFree> alignedBuffer(std::size_t count)
+{
+    const std::size_t bytes{(std::max<std::size_t>(count, 1)*sizeof(T)+kCacheLine-1)/kCacheLine*kCacheLine};
+    T* p{static_cast<T*>(std::aligned_alloc(kCacheLine, bytes))};
+    if(p==nullptr) throw std::bad_alloc{};
+    return std::unique_ptr<T[], AlignedFree>{p};
+}
+
+// Row-major rows x cols matrix, zero-initialised, rows 64-byte aligned
+// (same layout as in 34.BlockedMatrixMultiplication.cpp).
+template<class T>
+class Matrix{
+    static_assert(std::is_arithmetic_v<T>, "Matrix holds numbers");
+
+public:
+    Matrix(std::size_t rows, std::size_t cols)
+        : nRows{rows}, nCols{cols},
+          rowStride{(cols*sizeof(T)+kCacheLine-1)/kCacheLine*kCacheLine/sizeof(T)},
+          storage{alignedBuffer<T>(rows*rowStride)}
+    {
+        std::memset(storage.get(), 0, rows*rowStride*sizeof(T));
+    }
+
+    std::size_t rows() const { return nRows; }
+    std::size_t cols() const { return nCols; }
+    std::size_t stride() const { return rowStride; }
+
+    T& operator()(std::size_t i, std::size_t j) { return storage[i*rowStride+j]; }
+    const T& operator()(std::size_t i, std::size_t j) const { return storage[i*rowStride+j]; }
+
+    T* data() { return storage.get(); }
+    const T* data() const { return storage.get(); }
+
+private:
+    std::size_t nRows{}, nCols{}, rowStride{};
+    std::unique_ptr<T[], AlignedFree> storage;
+};
+
+// A square n x n window into some row-major storage.
+template<class T>
+struct View{
+    T* data{};
+    std::size_t stride{};
+
+    T* row(std::size_t i) const { return data+i*stride; }
+    T& operator()(std::size_t i, std::size_t j) const { return data[i*stride+j]; }
+    View quadrant(std::size_t qi, std::size_t qj, std::size_t half) const
+    {
+        return {data+qi*half*stride+qj*half, stride};
+    }
+};
+
+namespace blocked{
+
+// The packed kernel of 34.BlockedMatrixMultiplication.cpp, single threaded,
+// on views: C = A * B, all n x n.
+template<class T>
+struct Blocking{
+    typedef T V __attribute__((vector_size(kVectorBytes)));
+    static constexpr std::size_t kLanes{kVectorBytes/sizeof(T)};
+    static constexpr std::size_t kMR{6};
+    static constexpr std::size_t kNR{2*kLanes};
+    static constexpr std::size_t kKC{256};
+    static constexpr std::size_t kMC{kMR*16};
+};
+
+template<class T>
+void microKernel(std::size_t kc, const T* ap, const T* bp, T* c, std::size_t ldc, std::size_t rows, std::size_t cols)
+{
+    using B=Blocking<T>;
+    using V=typename B::V;
+    V acc[B::kMR][2]{};
+    for(std::size_t p{};p<kc;++p){
+        const V b0{*reinterpret_cast<const V*>(bp)};
+        const V b1{*reinterpret_cast<const V*>(bp+B::kLanes)};
+#pragma GCC unroll 8
+        for(std::size_t r{};r<B::kMR;++r){
+            const V ar{V{}+ap[r]};
+            acc[r][0]+=ar*b0;
+            acc[r][1]+=ar*b1;
+        }
+        ap+=B::kMR;
+        bp+=B::kNR;
+    }
+    T tile[B::kMR][B::kNR];
+    std::memcpy(tile, acc, sizeof(tile));
+    for(std::size_t r{};r<rows;++r){
+        for(std::size_t j{};j<cols;++j) c[r*ldc+j]+=tile[r][j];
+    }
+}
+
+// Packing buffers, reused across calls (the base case runs thousands of times)
+template<class T>
+struct Buffers{
+    std::unique_ptr<T[], AlignedFree> ap{alignedBuffer<T>(Blocking<T>::kMC*Blocking<T>::kKC)};
+    std::unique_ptr<T[], AlignedFree> bp;
+    std::size_t bpSize{};
+};
+
+template<class T>
+void multiply(View<const T> a, View<const T> b, View<T> c, std::size_t n, Buffers<T>& buffers)
+{
+    using B=Blocking<T>;
+    for(std::size_t i{};i<n;++i) std::fill_n(c.row(i), n, T{});
+    const std::size_t panels{(n+B::kNR-1)/B::kNR};
+    if(buffers.bpSize<panels*B::kNR*B::kKC){
+        buffers.bpSize=panels*B::kNR*B::kKC;
+        buffers.bp=alignedBuffer<T>(buffers.bpSize);
+    }
+    for(std::size_t p0{};p0<n;p0+=B::kKC){
+        const std::size_t kc{std::min(B::kKC, n-p0)};
+        T* bp{buffers.bp.get()};
+        for(std::size_t jr{};jr<n;jr+=B::kNR){
+            const std::size_t cols{std::min(B::kNR, n-jr)};
+            for(std::size_t p{};p<kc;++p){
+                const T* src{b.row(p0+p)+jr};
+                std::size_t j{};
+                for(;j<cols;++j) bp[j]=src[j];
+                for(;j<B::kNR;++j) bp[j]=T{};
+                bp+=B::kNR;
+            }
+        }
+        for(std::size_t i0{};i0<n;i0+=B::kMC){
+            const std::size_t mc{std::min(B::kMC, n-i0)};
+            T* ap{buffers.ap.get()};
+            for(std::size_t ir{};ir<mc;ir+=B::kMR){
+                const std::size_t rows{std::min(B::kMR, mc-ir)};
+                for(std::size_t p{};p<kc;++p){
+                    for(std::size_t r{};r<B::kMR;++r) *ap++=r<rows ? a(i0+ir+r, p0+p) : T{};
+                }
+            }
+            for(std::size_t jr{};jr<n;jr+=B::kNR){
+                for(std::size_t ir{};ir<mc;ir+=B::kMR){
+                    microKernel(kc, buffers.ap.get()+ir*kc, buffers.bp.get()+jr*kc, c.row(i0+ir)+jr, c.stride,
+                                std::min(B::kMR, mc-ir), std::min(B::kNR, n-jr));
+                }
+            }
+        }
+    }
+}
+
+}   // namespace blocked
+
+template<class T>
+class StrassenWinograd{
+public:
+    // Sizes <= cutoff go to the blocked kernel.
+    explicit StrassenWinograd(std::size_t cutoff=512)
+    {
+        set_cutoff(cutoff);
+    }
+
+    std::size_t cutoff() const { return cutoffSize; }
+
+    void set_cutoff(std::size_t cutoff)
+    {
+        if(cutoff<16) throw std::invalid_argument("StrassenWinograd: cutoff below 16 only adds overhead");
+        cutoffSize=cutoff;
+    }
+
+    // c = a * b for square matrices of the same size.
+    void multiply(const Matrix<T>& a, const Matrix<T>& b, Matrix<T>& c)
+    {
+        const std::size_t n{a.rows()};
+        if(a.cols()!=n || b.rows()!=n || b.cols()!=n || c.rows()!=n || c.cols()!=n){
+            throw std::invalid_argument("StrassenWinograd: matrices must be square and of the same size");
+        }
+        const std::size_t need{workspaceSize(n)};
+        if(capacity<need){
+            workspace=alignedBuffer<T>(need);
+            capacity=need;
+        }
+        top=0;
+        recurse({a.data(), a.stride()}, {b.data(), b.stride()}, {c.data(), c.stride()}, n);
+    }
+
+    std::size_t workspace_bytes() const { return capacity*sizeof(T); }
+
+private:
+    // Elements of arena needed below size n: 4 blocks per level (rounded up
+    // to whole cache lines so every block starts aligned).
+    std::size_t workspaceSize(std::size_t n) const
+    {
+        std::size_t total{};
+        while(n>cutoffSize){
+            n&=~std::size_t{1};         // peeled
+            n/=2;
+            total+=4*roundUp(n*n);
+        }
+        return total;
+    }
+
+    static std::size_t roundUp(std::size_t count)
+    {
+        constexpr std::size_t kPerLine{kCacheLine/sizeof(T)>0 ? kCacheLine/sizeof(T) : 1};
+        return (count+kPerLine-1)/kPerLine*kPerLine;
+    }
+
+    View<T> take(std::size_t h)
+    {
+        View<T> v{workspace.get()+top, h};
+        top+=roundUp(h*h);
+        return v;
+    }
+
+    // dst = x + y or x - y, h x h
+    static void combine(View<T> dst, View<const T> x, View<const T> y, bool subtract, std::size_t h)
+    {
+        for(std::size_t i{};i<h;++i){
+            T* d{dst.row(i)};
+            const T* xi{x.row(i)};
+            const T* yi{y.row(i)};
+            if(subtract) for(std::size_t j{};j<h;++j) d[j]=xi[j]-yi[j];
+            else for(std::size_t j{};j<h;++j) d[j]=xi[j]+yi[j];
+        }
+    }
+
+    static View<const T> in(View<T> v) { return {v.data, v.stride}; }
+
+    void recurse(View<const T> a, View<const T> b, View<T> c, std::size_t n)
+    {
+        if(n<=cutoffSize){
+            blocked::multiply(a, b, c, n, buffers);
+            return;
+        }
+        if(n%2==1){
+            const std::size_t m{n-1};
+            recurse(a, b, c, m);
+            peelFixUp(a, b, c, m);
+            return;
+        }
+
+        const std::size_t h{n/2};
+        const View<const T> a11{a.quadrant(0, 0, h)}, a12{a.quadrant(0, 1, h)}, a21{a.quadrant(1, 0, h)}, a22{a.quadrant(1, 1, h)};
+        const View<const T> b11{b.quadrant(0, 0, h)}, b12{b.quadrant(0, 1, h)}, b21{b.quadrant(1, 0, h)}, b22{b.quadrant(1, 1, h)};
+        const View<T> c11{c.quadrant(0, 0, h)}, c12{c.quadrant(0, 1, h)}, c21{c.quadrant(1, 0, h)}, c22{c.quadrant(1, 1, h)};
+
+        const std::size_t mark{top};
+        const View<T> x{take(h)}, y{take(h)}, q{take(h)}, r{take(h)};
+
+        recurse(a11, b11, q, h);                            // Q = M1
+        recurse(a12, b21, c11, h);                          // C11 = M2
+        combine(c11, in(c11), in(q), false, h);             // C11 = M1 + M2
+        combine(x, a21, a22, false, h);                     // X = S1
+        combine(y, b12, b11, true, h);                      // Y = T1
+        recurse(in(x), in(y), r, h);                        // R = M5
+        combine(x, in(x), a11, true, h);                    // X = S2
+        combine(y, b22, in(y), true, h);                    // Y = T2
+        recurse(in(x), in(y), c12, h);                      // C12 = M6
+        combine(q, in(q), in(c12), false, h);               // Q = U2
+        combine(y, in(y), b21, true, h);                    // Y = T4
+        recurse(a22, in(y), c21, h);                        // C21 = M4
+        combine(x, a12, in(x), true, h);                    // X = S4
+        recurse(in(x), b22, c12, h);                        // C12 = M3
+        combine(c12, in(c12), in(q), false, h);
+        combine(c12, in(c12), in(r), false, h);             // C12 = U2 + M5 + M3
+        combine(x, a11, a21, true, h);                      // X = S3
+        combine(y, b22, b12, true, h);                      // Y = T3
+        recurse(in(x), in(y), c22, h);                      // C22 = M7
+        combine(q, in(q), in(c22), false, h);               // Q = U3
+        combine(c21, in(q), in(c21), true, h);              // C21 = U3 - M4
+        combine(c22, in(q), in(r), false, h);               // C22 = U3 + M5
+
+        top=mark;
+    }
+
+    // C (m+1 x m+1) from its top-left m x m product: add the peeled row/column.
+    static void peelFixUp(View<const T> a, View<const T> b, View<T> c, std::size_t m)
+    {
+        for(std::size_t i{};i<m;++i){
+            const T aim{a(i, m)};
+            T* ci{c.row(i)};
+            const T* bm{b.row(m)};
+            for(std::size_t j{};j<m;++j) ci[j]+=aim*bm[j];
+        }
+        for(std::size_t i{};i<=m;++i){
+            T sum{};
+            for(std::size_t k{};k<=m;++k) sum+=a(i, k)*b(k, m);
+            c(i, m)=sum;
+        }
+        T* cm{c.row(m)};
+        std::fill_n(cm, m, T{});
+        for(std::size_t k{};k<=m;++k){
+            const T amk{a(m, k)};
+            const T* bk{b.row(k)};
+            for(std::size_t j{};j<m;++j) cm[j]+=amk*bk[j];
+        }
+    }
+
+    std::size_t cutoffSize{};
+    std::unique_ptr<T[], AlignedFree> workspace;
+    std::size_t capacity{};
+    std::size_t top{};
+    blocked::Buffers<T> buffers;
+};
+
+// Largest |x - y| relative to the largest |y|.
+template<class T>
+double relativeError(const Matrix<T>& x, const Matrix<T>& y)
+{
+    double diff{}, scale{};
+    for(std::size_t i{};i<x.rows();++i){
+        for(std::size_t j{};j<x.cols();++j){
+            diff=std::max(diff, std::fabs(static_cast<double>(x(i, j))-static_cast<double>(y(i, j))));
+            scale=std::max(scale, std::fabs(static_cast<double>(y(i, j))));
+        }
+    }
+    return scale>0 ? diff/scale : diff;
+}
+
+int main(){
+    // small check with a tiny cutoff, odd size so peeling is used too
+    {
+        const std::size_t n{37};
+        Matrix<long long> a{n, n}, b{n, n}, c{n, n}, expected{n, n};
+        for(std::size_t i{};i<n;++i){
+            for(std::size_t j{};j<n;++j){
+                a(i, j)=static_cast<long long>((i*7+j*3)%11)-5;
+                b(i, j)=static_cast<long long>((i*5+j)%13)-6;
+            }
+        }
+        for(std::size_t i{};i<n;++i){
+            for(std::size_t j{};j<n;++j){
+                for(std::size_t k{};k<n;++k) expected(i, j)+=a(i, k)*b(k, j);
+            }
+        }
+        StrassenWinograd<long long> strassen{16};
+        strassen.multiply(a, b, c);
+        std::cout<<"37x37 integer product with cutoff 16: "<<(relativeError(c, expected)==0 ? "exact" : "WRONG")<<"\n";
+    }
+
+    using Clock=std::chrono::steady_clock;
+    auto seconds=[](auto run){
+        auto t0{Clock::now()};
+        run();
+        return std::chrono::duration<double>{Clock::now()-t0}.count();
+    };
+    std::mt19937 rng{35};
+    std::uniform_real_distribution<double> value{-1.0, 1.0};
+    const std::size_t cutoffs[]{128, 256, 512};
+
+    std::cout<<std::fixed<<std::setprecision(3)
+             <<"double, vector "<<kVectorBytes<<" bytes. Time in seconds (relative error vs blocked)\n"
+             <<"    n    blocked      cutoff 128             cutoff 256             cutoff 512\n";
+    std::size_t crossover{};
+    for(std::size_t n : {std::size_t{512}, std::size_t{1024}, std::size_t{2048}, std::size_t{2049}, std::size_t{4096}}){
+        Matrix<double> a{n, n}, b{n, n}, reference{n, n}, c{n, n};
+        for(std::size_t i{};i<n;++i){
+            for(std::size_t j{};j<n;++j){
+                a(i, j)=value(rng);
+                b(i, j)=value(rng);
+            }
+        }
+        StrassenWinograd<double> plain{n};      // cutoff n: blocked kernel only
+        const double base{seconds([&]{ plain.multiply(a, b, reference); })};
+        std::cout<<std::setw(5)<<n<<std::setw(11)<<base;
+        bool faster{false};
+        for(std::size_t cut : cutoffs){
+            StrassenWinograd<double> strassen{cut};
+            const double t{seconds([&]{ strassen.multiply(a, b, c); })};
+            faster=faster || (cut<n && t<base);        // cut >= n is the blocked kernel itself
+            std::cout<<std::setw(10)<<t<<" ("<<std::scientific<<std::setprecision(0)<<relativeError(c, reference)
+                     <<std::fixed<<std::setprecision(3)<<")";
+        }
+        std::cout<<"\n";
+        if(faster && crossover==0) crossover=n;
+    }
+    if(crossover!=0) std::cout<<"Strassen-Winograd first wins at n = "<<crossover<<"\n";
+    else std::cout<<"Strassen-Winograd never won on this machine up to n = 4096\n";
+    return 0;
+}
+/*
+🔸 Output (sample, 1-core 2 GHz VM, g++ -O2 -march=native)
+37x37 integer product with cutoff 16: exact
+double, vector 64 bytes. Time in seconds (relative error vs blocked)
+    n    blocked      cutoff 128             cutoff 256             cutoff 512
+  512      0.012     0.014 (5e-15)     0.012 (3e-15)     0.009 (0e+00)
+ 1024      0.081     0.104 (1e-14)     0.112 (8e-15)     0.097 (3e-15)
+ 2048      0.660     0.798 (4e-14)     0.735 (2e-14)     0.649 (7e-15)
+ 2049      0.651     0.909 (4e-14)     0.757 (2e-14)     0.693 (7e-15)
+ 4096      5.989     6.779 (1e-13)     5.475 (5e-14)     4.578 (2e-14)
+Strassen-Winograd first wins at n = 2048
+
+⚠️ Notes
+ - With a fast blocked kernel the crossover is high: on this machine a
+   cutoff of 512 only pays off from n ≈ 2048, and saves ~25% at n = 4096.
+   Small cutoffs lose because the O(n^2) additions run at memory speed.
+   Re-measure on the target machine and pass that cutoff in.
+ - The error grows with every level (1e-13 vs 1e-15 for the plain kernel
+   here): fine for most double work, think twice for float.
+ - The workspace is kept between calls (workspace_bytes() tells how much),
+   so a batch job multiplying many matrices allocates it only once. One
+   StrassenWinograd object must not be used by two threads at a time.
+*/
@@ -0,0 +1,340 @@
+/*
+➕➖ Fused element-wise matrix add / subtract
+25.MatrixAdditionandSubtraction.cpp computes c=a+b in one double loop and
+d=a-b in a second one. For big matrices each loop is limited by memory, not
+by the + or -:
+    loop 1: read a, read b, write c
+    loop 2: read a, read b, write d      ← a and b come from RAM a 2nd time
+Doing both in ONE pass reads a and b once: 4 matrix transfers instead of 6.
+
+🔹 Expression templates
+a + b does not compute anything, it returns a small object that remembers
+"a plus b" (Elementwise<std::plus<>, Matrix, Matrix>). The work happens when
+that object is assigned to a matrix, in one loop, with no temporary matrix
+even for longer chains:
+    c = a + b - e;        // one loop: c[j] = (a[j] + b[j]) - e[j]
+Each row is handed over as plain pointers, so after inlining the inner loop
+is a simple array loop that the compiler vectorises.
+
+🔹 Fusing several outputs
+    evaluate(assign(c, a + b), assign(d, a - b));
+walks the matrices ONCE, in chunks of kChunk elements of a row: for a chunk
+it writes c, then d. The chunk of a and b read for c is still in L1 when d
+needs it, so a and b come from memory only once.
+
+🔹 Threads
+Above kParallelElements the rows are split into one block per hardware
+thread (std::async), as in 31.MinMaxReduction.cpp.
+*/
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <concepts>
+#include <functional>
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+#include <future>
+#include <chrono>
+#include <iomanip>
+
+constexpr std::size_t kCacheLine{64};
+constexpr std::size_t kChunk{1024};                     // elements per fused step
+constexpr std::size_t kParallelElements{std::size_t{1}<<20};
+
+struct AlignedFree{
+    void operator()(void* p) const { std::free(p); }
+};
+
+template<class T>
+std::unique_ptr<T[], AlignedFree> alignedBuffer(std::size_t count)
+{
+    const std::size_t bytes{(std::max<std::size_t>(count, 1)*sizeof(T)+kCacheLine-1)/kCacheLine*kCacheLine};
+    T* p{static_cast<T*>(std::aligned_alloc(kCacheLine, bytes))};
+    if(p==nullptr) throw std::bad_alloc{};
+    return std::unique_ptr<T[], AlignedFree>{p};
+}
+
+template<class T> class Matrix;
+
+template<class X>
+concept MatrixExpression=requires(const X& x, std::size_t i){
+    { x.rows() }->std::convertible_to<std::size_t>;
+    { x.cols() }->std::convertible_to<std::size_t>;
+    x.row(i)[i];
+    { x.refersTo(static_cast<const void*>(nullptr)) }->std::same_as<bool>;
+};
+
+template<class X> struct IsMatrix : std::false_type {};
+template<class T> struct IsMatrix<Matrix<T>> : std::true_type {};
+
+// Matrices are held by reference, expression nodes (small temporaries) by value.
+template<class X>
+using Stored=std::conditional_t<IsMatrix<X>::value, const X&, X>;
+
+namespace detail{
+
+template<class F>
+void forRowBlocks(std::size_t rows, std::size_t cols, F f)
+{
+    unsigned threads{std::max(1u, std::thread::hardware_concurrency())};
+    if(rows*cols<kParallelElements) threads=1;
+    threads=static_cast<unsigned>(std::min<std::size_t>(threads, std::max<std::size_t>(rows, 1)));
+    const std::size_t perBlock{(rows+threads-1)/threads};
+
+    std::vector<std::future<void>> pending;
+    for(unsigned t{1};t<threads;++t){
+        const std::size_t begin{t*perBlock};
+        if(begin>=rows) break;
+        pending.push_back(std::async(std::launch::async, f, begin, std::min(rows, begin+perBlock)));
+    }
+    f(std::size_t{0}, std::min(rows, perBlock));
+    for(std::future<void>& p : pending) p.get();
+}
+
+}   // namespace detail
+
+// Row-major rows x cols matrix, zero-initialised, rows 64-byte aligned
+// (same layout as in 34.BlockedMatrixMultiplication.cpp).
+template<class T>
+class Matrix{
+    static_assert(std::is_arithmetic_v<T>, "Matrix holds numbers");
+
+public:
+    Matrix(std::size_t rows, std::size_t cols)
+        : nRows{rows}, nCols{cols},
+          rowStride{(cols*sizeof(T)+kCacheLine-1)/kCacheLine*kCacheLine/sizeof(T)},
+          storage{alignedBuffer<T>(rows*rowStride)}
+    {
+        std::memset(storage.get(), 0, rows*rowStride*sizeof(T));
+    }
+
+    // Evaluates the expression in one pass, no temporary matrix.
+    template<MatrixExpression E>
+        requires (!IsMatrix<E>::value)
+    Matrix& operator=(const E& expression)
+    {
+        if(expression.rows()!=nRows || expression.cols()!=nCols){
+            throw std::invalid_argument("Matrix: expression has a different size");
+        }
+        detail::forRowBlocks(nRows, nCols, [&](std::size_t first, std::size_t last){
+            for(std::size_t i{first};i<last;++i){
+                T* out{row(i)};
+                const auto in{expression.row(i)};
+                for(std::size_t j{};j<nCols;++j) out[j]=static_cast<T>(in[j]);
+            }
+        });
+        return *this;
+    }
+
+    std::size_t rows() const { return nRows; }
+    std::size_t cols() const { return nCols; }
+
+    T& operator()(std::size_t i, std::size_t j) { return storage[i*rowStride+j]; }
+    const T& operator()(std::size_t i, std::size_t j) const { return storage[i*rowStride+j]; }
+
+    T* row(std::size_t i) { return storage.get()+i*rowStride; }
+    const T* row(std::size_t i) const { return storage.get()+i*rowStride; }
+
+    bool refersTo(const void* m) const { return m==this; }
+
+private:
+    std::size_t nRows{}, nCols{}, rowStride{};
+    std::unique_ptr<T[], AlignedFree> storage;
+};
+
+// op(l, r) element by element; nothing is computed until assignment.
+template<class Op, MatrixExpression L, MatrixExpression R>
+class Elementwise{
+public:
+    Elementwise(const L& l, const R& r) : lhs{l}, rhs{r}
+    {
+        if(l.rows()!=r.rows() || l.cols()!=r.cols()){
+            throw std::invalid_argument("matrix expression: operands have different sizes");
+        }
+    }
+
+    std::size_t rows() const { return lhs.rows(); }
+    std::size_t cols() const { return lhs.cols(); }
+
+    auto row(std::size_t i) const
+    {
+        struct Row{
+            decltype(std::declval<const L&>().row(0)) l;
+            decltype(std::declval<const R&>().row(0)) r;
+            auto operator[](std::size_t j) const { return Op{}(l[j], r[j]); }
+        };
+        return Row{lhs.row(i), rhs.row(i)};
+    }
+
+    bool refersTo(const void* m) const { return lhs.refersTo(m) || rhs.refersTo(m); }
+
+private:
+    Stored<L> lhs;
+    Stored<R> rhs;
+};
+
+template<MatrixExpression L, MatrixExpression R>
+auto operator+(const L& l, const R& r) { return Elementwise<std::plus<>, L, R>{l, r}; }
+
+template<MatrixExpression L, MatrixExpression R>
+auto operator-(const L& l, const R& r) { return Elementwise<std::minus<>, L, R>{l, r}; }
+
+// target = expression, to be run by evaluate() together with others
+template<class T, MatrixExpression E>
+struct Assignment{
+    Matrix<T>& target;
+    Stored<E> expression;
+
+    void run(std::size_t i, std::size_t j0, std::size_t j1) const
+    {
+        T* out{target.row(i)};
+        const auto in{expression.row(i)};
+        for(std::size_t j{j0};j<j1;++j) out[j]=static_cast<T>(in[j]);
+    }
+};
+
+template<class T, MatrixExpression E>
+Assignment<T, E> assign(Matrix<T>& target, const E& expression)
+{
+    if(target.rows()!=expression.rows() || target.cols()!=expression.cols()){
+        throw std::invalid_argument("assign: target and expression have different sizes");
+    }
+    return {target, expression};
+}
+
+// Runs all assignments in ONE pass over the rows. All targets must have the
+// same size, and no expression may read a target assigned before it in the
+// list (it would see half-updated values).
+template<class... A>
+void evaluate(const A&... assignments)
+{
+    static_assert(sizeof...(A)>0, "evaluate needs at least one assignment");
+    const void* targets[]{static_cast<const void*>(&assignments.target)...};
+    const std::size_t rows[]{assignments.target.rows()...};
+    const std::size_t cols[]{assignments.target.cols()...};
+    std::size_t m{};
+    ([&]{
+        if(rows[m]!=rows[0] || cols[m]!=cols[0]){
+            throw std::invalid_argument("evaluate: all targets must have the same size");
+        }
+        for(std::size_t k{};k<m;++k){
+            if(assignments.expression.refersTo(targets[k])){
+                throw std::invalid_argument("evaluate: an expression reads a target written before it");
+            }
+        }
+        ++m;
+    }(), ...);
+
+    detail::forRowBlocks(rows[0], cols[0], [&](std::size_t first, std::size_t last){
+        for(std::size_t i{first};i<last;++i){
+            for(std::size_t j0{};j0<cols[0];j0+=kChunk){
+                const std::size_t j1{std::min(cols[0], j0+kChunk)};
+                (assignments.run(i, j0, j1), ...);
+            }
+        }
+    });
+}
+
+// The explicit form of the common case: c = a + b and d = a - b in one pass.
+template<class T>
+void add_sub(const Matrix<T>& a, const Matrix<T>& b, Matrix<T>& sum, Matrix<T>& difference)
+{
+    evaluate(assign(sum, a+b), assign(difference, a-b));
+}
+
+template<class T>
+void print(const char* title, const Matrix<T>& m)
+{
+    std::cout<<title<<"\n";
+    for(std::size_t i{};i<m.rows();++i){
+        for(std::size_t j{};j<m.cols();++j) std::cout<<m(i, j)<<" ";
+        std::cout<<"\n";
+    }
+}
+
+int main(){
+    Matrix<int> a{2, 3}, b{2, 3}, c{2, 3}, d{2, 3};
+    for(std::size_t i{};i<2;++i){
+        for(std::size_t j{};j<3;++j){
+            a(i, j)=3;
+            b(i, j)=1;
+        }
+    }
+    add_sub(a, b, c, d);
+    print("Added Matrix", c);
+    print("Subtracted Matrix", d);
+    c=a+b+b-d;
+    print("a + b + b - d", c);
+
+    // 4096 x 4096 floats: 64 MB per matrix
+    using Clock=std::chrono::steady_clock;
+    const std::size_t n{4096};
+    Matrix<float> x{n, n}, y{n, n}, sum{n, n}, difference{n, n};
+    for(std::size_t i{};i<n;++i){
+        for(std::size_t j{};j<n;++j){
+            x(i, j)=static_cast<float>((i+j)%100);
+            y(i, j)=static_cast<float>((i*j)%7);
+        }
+    }
+    auto ms=[](auto run){
+        double best{1e300};
+        for(int repeat{};repeat<3;++repeat){
+            auto t0{Clock::now()};
+            run();
+            best=std::min(best, std::chrono::duration<double, std::milli>{Clock::now()-t0}.count());
+        }
+        return best;
+    };
+    std::cout<<std::fixed<<std::setprecision(1)<<n<<" x "<<n<<" float, best of 3, "
+             <<std::max(1u, std::thread::hardware_concurrency())<<" threads\n";
+    std::cout<<"two loops (as in 25)       : "<<ms([&]{
+        for(std::size_t i{};i<n;++i) for(std::size_t j{};j<n;++j) sum(i, j)=x(i, j)+y(i, j);
+        for(std::size_t i{};i<n;++i) for(std::size_t j{};j<n;++j) difference(i, j)=x(i, j)-y(i, j);
+    })<<" ms\n";
+    std::cout<<"sum = x+y; difference = x-y: "<<ms([&]{ sum=x+y; difference=x-y; })<<" ms\n";
+    std::cout<<"add_sub (fused)            : "<<ms([&]{ add_sub(x, y, sum, difference); })<<" ms\n";
+
+    bool ok{true};
+    for(std::size_t i{};i<n;i+=97){
+        for(std::size_t j{};j<n;j+=89){
+            ok=ok && sum(i, j)==x(i, j)+y(i, j) && difference(i, j)==x(i, j)-y(i, j);
+        }
+    }
+    std::cout<<"results match: "<<(ok ? "yes" : "NO")<<"\n";
+    return 0;
+}
+/*
+🔸 Output (sample, 1-core 2 GHz VM)
+Added Matrix
+4 4 4 
+4 4 4 
+Subtracted Matrix
+2 2 2 
+2 2 2 
+a + b + b - d
+3 3 3 
+3 3 3 
+4096 x 4096 float, best of 3, 1 threads
+two loops (as in 25)       : 41.9 ms
+sum = x+y; difference = x-y: 33.1 ms
+add_sub (fused)            : 27.2 ms
+results match: yes
+
+⚠️ Notes
+ - Why 1.25x and not 1.5x: before the CPU writes a cache line of c it first
+   READS it (write-allocate), so two passes move 8 matrices' worth of data
+   and the fused one 6, not 6 and 4.
+ - The two-loop version is slower than "sum = x+y" mostly because
+   sum(i, j) recomputes i*stride+j and goes through operator() every time;
+   the expression loop works on row pointers.
+ - auto e = a + b; keeps references to a and b: e must not outlive them.
+ - evaluate(assign(a, a + b), assign(d, a - b)) throws: the second
+   expression would read the already updated a.
+*/
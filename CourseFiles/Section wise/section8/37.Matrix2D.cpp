@@ -0,0 +1,332 @@
+/*
+🧱 Matrix2D<T>: a 2D array with its size chosen at run time
+Studentpracticeexercise/StudentExercise7.cpp and 27.MatrixMultiplication.cpp
+declare int a[100][100], b[100][100], mult[100][100]:
+ - 3 x 40 KB = 120 KB of STACK (the whole stack is often 1 MB, 8 MB at most)
+ - the size is fixed: 101 rows silently writes past the end
+ - int A[m][n] with m, n from cin is not standard C++ (24.Multi-DimensionalArray.cpp)
+vector<vector<int>> fixes the size but makes every row its own allocation,
+scattered over the heap, one extra pointer jump per access.
+
+🔹 One contiguous block
+Matrix2D<T> allocates rows x stride elements ONCE, row after row, exactly
+the layout of int A[rows][cols] (row-major), just on the heap:
+    A(i, j)  and  A[i][j]      → data[i*stride + j]
+stride is cols, or with Padding::CacheLine rounded up so that every row
+starts on a 64-byte cache line (helps SIMD loops, avoids two threads
+sharing the last line of neighbouring rows).
+
+🔹 Rows, columns and views
+    for(auto row : A)           // row is a std::span<T>, like int (&row)[3]
+        for(auto& x : row) ...  // in 26.2dArrayUsingForEachLoop.cpp
+    A.row(i)                    // std::span<T> of cols elements
+    A.col(j)                    // StridedSpan<T>: every stride-th element
+    A.view()                    // MatrixView<T>: data + extents + strides,
+                                //   the idea of C++23 std::mdspan
+    A.view().transposed()       // swap the strides: A^T without copying
+    A.view().block(r, c, h, w)  // a sub-matrix, still no copy
+
+🔹 Move-only
+Copying a 10000 x 10000 matrix by accident (pass by value, return a
+member...) copies 400 MB. Matrix2D has no copy constructor: it can only be
+MOVED (a pointer swap) or copied on purpose with clone().
+*/
+
+#include <iostream>
+#include <span>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <chrono>
+#include <iomanip>
+
+constexpr std::size_t kCacheLine{64};
+
+enum class Padding{ None, CacheLine };
+
+// 1D view of every stride-th element (a column of a row-major matrix).
+template<class T>
+class StridedSpan{
+public:
+    class iterator{
+    public:
+        using iterator_category=std::forward_iterator_tag;
+        using value_type=std::remove_cv_t<T>;
+        using difference_type=std::ptrdiff_t;
+        using pointer=T*;
+        using reference=T&;
+
+        iterator()=default;
+        iterator(T* p, std::size_t stride) : current{p}, step{stride} {}
+
+        T& operator*() const { return *current; }
+        iterator& operator++() { current+=step; return *this; }
+        iterator operator++(int) { iterator old{*this}; ++*this; return old; }
+        bool operator==(const iterator& other) const { return current==other.current; }
+
+    private:
+        T* current{};
+        std::size_t step{};
+    };
+
+    StridedSpan(T* data, std::size_t size, std::size_t stride) : first{data}, count{size}, step{stride} {}
+
+    std::size_t size() const { return count; }
+    std::size_t stride() const { return step; }
+    T& operator[](std::size_t i) const { return first[i*step]; }
+    iterator begin() const { return {first, step}; }
+    iterator end() const { return {first+count*step, step}; }
+
+private:
+    T* first{};
+    std::size_t count{}, step{};
+};
+
+// Non-owning rows x cols view with independent row and column strides.
+template<class T>
+class MatrixView{
+public:
+    MatrixView(T* data, std::size_t rows, std::size_t cols, std::size_t rowStride, std::size_t colStride=1)
+        : origin{data}, extents{rows, cols}, strides{rowStride, colStride} {}
+
+    std::size_t extent(int dim) const { return extents[dim]; }
+    std::size_t stride(int dim) const { return strides[dim]; }
+    std::size_t rows() const { return extents[0]; }
+    std::size_t cols() const { return extents[1]; }
+
+    T& operator()(std::size_t i, std::size_t j) const { return origin[i*strides[0]+j*strides[1]]; }
+
+    MatrixView transposed() const { return {origin, extents[1], extents[0], strides[1], strides[0]}; }
+
+    MatrixView block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const
+    {
+        if(row+rows>extents[0] || col+cols>extents[1]){
+            throw std::out_of_range("MatrixView::block: block reaches outside the view");
+        }
+        return {&(*this)(row, col), rows, cols, strides[0], strides[1]};
+    }
+
+private:
+    T* origin{};
+    std::size_t extents[2]{};
+    std::size_t strides[2]{};
+};
+
+template<class T>
+class Matrix2D{
+public:
+    // Row iterator for range-for: each step yields the next row as a span.
+    template<class U>
+    class RowIterator{
+    public:
+        using iterator_category=std::forward_iterator_tag;
+        using value_type=std::span<U>;
+        using difference_type=std::ptrdiff_t;
+
+        RowIterator()=default;
+        RowIterator(U* p, std::size_t cols, std::size_t stride) : current{p}, width{cols}, step{stride} {}
+
+        std::span<U> operator*() const { return {current, width}; }
+        RowIterator& operator++() { current+=step; return *this; }
+        RowIterator operator++(int) { RowIterator old{*this}; ++*this; return old; }
+        bool operator==(const RowIterator& other) const { return current==other.current; }
+
+    private:
+        U* current{};
+        std::size_t width{}, step{};
+    };
+
+    Matrix2D()=default;
+
+    // rows x cols elements, value-initialised (0 for numbers).
+    Matrix2D(std::size_t rows, std::size_t cols, Padding padding=Padding::None)
+        : nRows{rows}, nCols{cols}, rowStride{strideFor(cols, padding)}
+    {
+        if(rowStride!=0 && rows>static_cast<std::size_t>(-1)/sizeof(T)/rowStride){
+            throw std::length_error("Matrix2D: rows x cols is too large");
+        }
+        const std::size_t count{rows*rowStride};
+        elements=static_cast<T*>(::operator new(std::max<std::size_t>(count, 1)*sizeof(T), std::align_val_t{kCacheLine}));
+        try{
+            std::uninitialized_value_construct_n(elements, count);
+        }
+        catch(...){
+            ::operator delete(elements, std::align_val_t{kCacheLine});
+            throw;
+        }
+    }
+
+    Matrix2D(const Matrix2D&)=delete;
+    Matrix2D& operator=(const Matrix2D&)=delete;
+
+    Matrix2D(Matrix2D&& other) noexcept
+        : nRows{std::exchange(other.nRows, 0)}, nCols{std::exchange(other.nCols, 0)},
+          rowStride{std::exchange(other.rowStride, 0)}, elements{std::exchange(other.elements, nullptr)} {}
+
+    Matrix2D& operator=(Matrix2D&& other) noexcept
+    {
+        if(this!=&other){
+            release();
+            nRows=std::exchange(other.nRows, 0);
+            nCols=std::exchange(other.nCols, 0);
+            rowStride=std::exchange(other.rowStride, 0);
+            elements=std::exchange(other.elements, nullptr);
+        }
+        return *this;
+    }
+
+    ~Matrix2D() { release(); }
+
+    // The one way to copy: explicit, so it shows up in the code.
+    Matrix2D clone() const
+    {
+        Matrix2D copy{nRows, nCols, rowStride==nCols ? Padding::None : Padding::CacheLine};
+        for(std::size_t i{};i<nRows;++i) std::copy_n(row(i).data(), nCols, copy.row(i).data());
+        return copy;
+    }
+
+    std::size_t rows() const { return nRows; }
+    std::size_t cols() const { return nCols; }
+    std::size_t stride() const { return rowStride; }      // elements from one row to the next
+    bool empty() const { return nRows==0 || nCols==0; }
+    T* data() { return elements; }
+    const T* data() const { return elements; }
+
+    T& operator()(std::size_t i, std::size_t j) { return elements[i*rowStride+j]; }
+    const T& operator()(std::size_t i, std::size_t j) const { return elements[i*rowStride+j]; }
+
+    T& at(std::size_t i, std::size_t j)
+    {
+        check(i, j);
+        return (*this)(i, j);
+    }
+    const T& at(std::size_t i, std::size_t j) const
+    {
+        check(i, j);
+        return (*this)(i, j);
+    }
+
+    // A[i][j] works as with int A[m][n]
+    std::span<T> operator[](std::size_t i) { return row(i); }
+    std::span<const T> operator[](std::size_t i) const { return row(i); }
+
+    std::span<T> row(std::size_t i) { return {elements+i*rowStride, nCols}; }
+    std::span<const T> row(std::size_t i) const { return {elements+i*rowStride, nCols}; }
+    StridedSpan<T> col(std::size_t j) { return {elements+j, nRows, rowStride}; }
+    StridedSpan<const T> col(std::size_t j) const { return {elements+j, nRows, rowStride}; }
+
+    MatrixView<T> view() { return {elements, nRows, nCols, rowStride}; }
+    MatrixView<const T> view() const { return {elements, nRows, nCols, rowStride}; }
+
+    RowIterator<T> begin() { return {elements, nCols, rowStride}; }
+    RowIterator<T> end() { return {elements+nRows*rowStride, nCols, rowStride}; }
+    RowIterator<const T> begin() const { return {elements, nCols, rowStride}; }
+    RowIterator<const T> end() const { return {elements+nRows*rowStride, nCols, rowStride}; }
+
+private:
+    static std::size_t strideFor(std::size_t cols, Padding padding)
+    {
+        if(padding==Padding::None || kCacheLine%sizeof(T)!=0) return cols;
+        constexpr std::size_t kPerLine{kCacheLine/sizeof(T)};
+        return (cols+kPerLine-1)/kPerLine*kPerLine;
+    }
+
+    void check(std::size_t i, std::size_t j) const
+    {
+        if(i>=nRows || j>=nCols){
+            throw std::out_of_range("Matrix2D: (" + std::to_string(i) + ", " + std::to_string(j) + ") is outside "
+                                    + std::to_string(nRows) + " x " + std::to_string(nCols));
+        }
+    }
+
+    void release()
+    {
+        if(elements!=nullptr){
+            std::destroy_n(elements, nRows*rowStride);
+            ::operator delete(elements, std::align_val_t{kCacheLine});
+            elements=nullptr;
+        }
+    }
+
+    std::size_t nRows{}, nCols{}, rowStride{};
+    T* elements{};
+};
+
+template<class M>
+void print(const M& m)
+{
+    for(std::size_t i{};i<m.rows();++i){
+        for(std::size_t j{};j<m.cols();++j) std::cout<<m(i, j)<<"\t";
+        std::cout<<"\n";
+    }
+}
+
+int main(){
+    std::size_t m{}, n{};
+    std::cout<<"Enter no. of Rows and Columns: "<<std::flush;
+    std::cin>>m>>n;
+    Matrix2D<int> A{m, n, Padding::CacheLine};      // any size, nothing on the stack
+
+    int next{1};
+    for(auto row : A){                              // as in 26.2dArrayUsingForEachLoop.cpp
+        for(auto& elem : row) elem=next++;
+    }
+    std::cout<<"A (stride "<<A.stride()<<" ints per row):\n";
+    for(auto row : std::as_const(A)){
+        for(int elem : row) std::cout<<elem<<" ";
+        std::cout<<"\n";
+    }
+    if(!A.empty()){
+        int columnSum{};
+        for(int x : A.col(0)) columnSum+=x;
+        std::cout<<"sum of column 0: "<<columnSum<<", A[0][n-1] = "<<A[0][n-1]<<"\n";
+        std::cout<<"transposed view:\n";
+        print(A.view().transposed());
+    }
+    try{
+        A.at(m, 0)=1;
+    }
+    catch(const std::out_of_range& e){
+        std::cout<<"at(): "<<e.what()<<"\n";
+    }
+
+    // Moving a big matrix is a pointer swap; clone() copies every element.
+    using Clock=std::chrono::steady_clock;
+    Matrix2D<float> big{8000, 8000};                 // 256 MB: impossible on the stack
+    auto t0{Clock::now()};
+    Matrix2D<float> moved{std::move(big)};
+    auto t1{Clock::now()};
+    Matrix2D<float> copy{moved.clone()};
+    auto t2{Clock::now()};
+    std::cout<<std::fixed<<std::setprecision(3)
+             <<"8000 x 8000 float: move "<<std::chrono::duration<double, std::milli>{t1-t0}.count()<<" ms, clone "
+             <<std::chrono::duration<double, std::milli>{t2-t1}.count()<<" ms\n";
+    return 0;
+}
+/*
+🔸 Output (sample)
+Enter no. of Rows and Columns: 2 3
+A (stride 16 ints per row):
+1 2 3
+4 5 6
+sum of column 0: 5, A[0][n-1] = 3
+transposed view:
+1	4
+2	5
+3	6
+at(): Matrix2D: (2, 0) is outside 2 x 3
+8000 x 8000 float: move 0.000 ms, clone 153.514 ms
+
+⚠️ Notes
+ - A[i] returns a std::span by value; A[i][j] costs the same as A(i, j)
+   once inlined.
+ - Views and spans do not own anything: they must not outlive the matrix
+   (or be used after it was moved from).
+ - Padding wastes at most 60 bytes per row; it only pays off for rows that
+   are walked with SIMD or split between threads.
+*/
@@ -0,0 +1,304 @@
+/*
+🖨️ Printing patterns fast: build rows in a buffer, write big blocks
+17.BingoPattern.cpp - 23.SquareOfStar.cpp and Codingexercise/CodingExercise37-41
+(Draw(int n)) print one cell at a time:
+    cout<<"* ";     // n*n stream calls
+    cout<<endl;     // endl = '\n' + FLUSH: one write() system call per row
+For n = 5000 the square is 25 million stream calls and 5000 system calls.
+
+🔹 One table of shapes
+Every pattern is "print a star where a condition holds" over an n x n grid,
+so they differ only in the condition and in what an empty cell prints:
+    shape                 star when        empty cell
+    Square                always           -
+    LowerTriangle         i >= j           nothing    (18, CodingExercise38)
+    UpperTriangle         j >= i           "  "       (19, CodingExercise39)
+    Cross                 i==j, i+j==n-1   "  "       (20)
+    CrossLowerTriangle    i+j >= n-1       "  "       (CodingExercise40)
+    CrossUpperTriangle    i+j <= n-1       nothing    (CodingExercise41)
+    NumberedGrid          1, 2, 3 ... followed by a tab  (17)
+kShapes holds one entry per row of this table; the renderer does not know
+any shape by name.
+
+🔹 Runs instead of cells
+A row is split into runs of equal cells ("* * * " then "      "...). Each
+run is copied with ONE memcpy from a prebuilt line of stars or blanks into
+a reusable line buffer, so a full row of the square is a single memcpy.
+
+🔹 Block output
+Rows are appended to a 1 MB block; when it is full it goes out with one
+write() system call, bypassing iostream completely. n = 5000 (50 MB of
+stars) is ~50 system calls instead of 5000 flushes.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <cerrno>
+#include <charconv>
+#include <stdexcept>
+#include <system_error>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <fcntl.h>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+enum class EmptyCell{ Skip, Blank };        // print nothing / print "  "
+enum class CellKind{ Star, Number };
+
+struct Shape{
+    const char* name;
+    bool (*star)(long long i, long long j, long long n);
+    EmptyCell empty;
+    CellKind kind;
+};
+
+constexpr Shape kShapes[]{
+    {"Square",             [](long long, long long, long long){ return true; },     EmptyCell::Skip,  CellKind::Star},
+    {"LowerTriangle",      [](long long i, long long j, long long){ return i>=j; }, EmptyCell::Skip,  CellKind::Star},
+    {"UpperTriangle",      [](long long i, long long j, long long){ return j>=i; }, EmptyCell::Blank, CellKind::Star},
+    {"Cross",              [](long long i, long long j, long long n){ return i==j || i+j==n-1; }, EmptyCell::Blank, CellKind::Star},
+    {"CrossLowerTriangle", [](long long i, long long j, long long n){ return i+j>=n-1; }, EmptyCell::Blank, CellKind::Star},
+    {"CrossUpperTriangle", [](long long i, long long j, long long n){ return i+j<=n-1; }, EmptyCell::Skip, CellKind::Star},
+    {"NumberedGrid",       [](long long, long long, long long){ return true; },     EmptyCell::Skip,  CellKind::Number},
+};
+
+// Collects output in a block and hands whole blocks to write() (or to a
+// string, for testing).
+class BlockWriter{
+public:
+    explicit BlockWriter(int fd, std::size_t capacity=std::size_t{1}<<20)
+        : fd{fd}, block(capacity) {}
+
+    explicit BlockWriter(std::string& target, std::size_t capacity=std::size_t{1}<<20)
+        : target{&target}, block(capacity) {}
+
+    BlockWriter(const BlockWriter&)=delete;
+    BlockWriter& operator=(const BlockWriter&)=delete;
+
+    ~BlockWriter()
+    {
+        try{
+            flush();
+        }
+        catch(const std::system_error&){
+            // nowhere to report it from a destructor; call flush() to see errors
+        }
+    }
+
+    // Room for `bytes` more characters; commit() says how many were used.
+    char* reserve(std::size_t bytes)
+    {
+        if(used+bytes>block.size()){
+            flush();
+            if(bytes>block.size()) block.resize(bytes);
+        }
+        return block.data()+used;
+    }
+
+    void commit(std::size_t bytes) { used+=bytes; }
+
+    void flush()
+    {
+        if(target!=nullptr) target->append(block.data(), used);
+        else writeAll(block.data(), used);
+        used=0;
+    }
+
+private:
+    void writeAll(const char* p, std::size_t n) const
+    {
+        while(n>0){
+#if defined(_WIN32)
+            const int written{::_write(fd, p, static_cast<unsigned>(std::min<std::size_t>(n, 1u<<30)))};
+#else
+            const ssize_t written{::write(fd, p, n)};
+#endif
+            if(written<0){
+                if(errno==EINTR) continue;
+                throw std::system_error{errno, std::generic_category(), "BlockWriter: write failed"};
+            }
+            p+=written;
+            n-=static_cast<std::size_t>(written);
+        }
+    }
+
+    int fd{-1};
+    std::string* target{};
+    std::vector<char> block;
+    std::size_t used{};
+};
+
+class PatternRenderer{
+public:
+    void render(const Shape& shape, long long n, BlockWriter& out)
+    {
+        if(n<=0) return;
+        const std::size_t width{static_cast<std::size_t>(n)};
+        if(shape.kind==CellKind::Number){
+            renderNumbers(width, out);
+            return;
+        }
+        if(stars.size()<2*width){               // prebuilt runs, reused between calls
+            stars.resize(2*width);
+            blanks.assign(2*width, ' ');
+            for(std::size_t j{};j<width;++j){
+                stars[2*j]='*';
+                stars[2*j+1]=' ';
+            }
+        }
+        for(long long i{};i<n;++i){
+            char* line{out.reserve(2*width+1)};
+            std::size_t length{};
+            long long j{};
+            while(j<n){
+                const bool star{shape.star(i, j, n)};
+                long long end{j+1};
+                while(end<n && shape.star(i, end, n)==star) ++end;
+                const std::size_t cells{static_cast<std::size_t>(end-j)};
+                if(star){
+                    std::memcpy(line+length, stars.data(), 2*cells);
+                    length+=2*cells;
+                }
+                else if(shape.empty==EmptyCell::Blank){
+                    std::memcpy(line+length, blanks.data(), 2*cells);
+                    length+=2*cells;
+                }
+                j=end;
+            }
+            line[length++]='\n';
+            out.commit(length);
+        }
+    }
+
+private:
+    // 1 2 3 ... n*n, each followed by a tab, n per line (17.BingoPattern.cpp)
+    static void renderNumbers(std::size_t n, BlockWriter& out)
+    {
+        unsigned long long count{1};
+        for(std::size_t i{};i<n;++i){
+            char* line{out.reserve(n*21+1)};    // 20 digits + tab per cell at most
+            char* p{line};
+            for(std::size_t j{};j<n;++j){
+                p=std::to_chars(p, p+20, count++).ptr;
+                *p++='\t';
+            }
+            *p++='\n';
+            out.commit(static_cast<std::size_t>(p-line));
+        }
+    }
+
+    std::string stars, blanks;
+};
+
+// The cell-by-cell loop of the lessons, kept for the check and the benchmark.
+void drawNaive(const Shape& shape, long long n, std::ostream& out)
+{
+    long long count{1};
+    for(long long i{};i<n;++i){
+        for(long long j{};j<n;++j){
+            if(shape.kind==CellKind::Number) out<<count++<<"\t";
+            else if(shape.star(i, j, n)) out<<"* ";
+            else if(shape.empty==EmptyCell::Blank) out<<"  ";
+        }
+        out<<std::endl;
+    }
+}
+
+int main(){
+    std::cout<<"Shapes:";
+    for(std::size_t s{};s<std::size(kShapes);++s) std::cout<<" "<<s<<"."<<kShapes[s].name;
+    std::cout<<"\nEnter shape number and size of square grid: ";
+    std::size_t shape{};
+    long long n{};
+    std::cin>>shape>>n;
+    if(shape>=std::size(kShapes)){
+        std::cout<<"no such shape\n";
+        return 1;
+    }
+    std::cout.flush();                          // the prompt must come out before our write()s
+    PatternRenderer renderer;
+    {
+        BlockWriter out{1};
+        renderer.render(kShapes[shape], n, out);
+    }
+
+    // same bytes as the cout loops for every shape and small sizes
+    bool ok{true};
+    for(const Shape& s : kShapes){
+        for(long long size{0};size<=9;++size){
+            std::string fast;
+            {
+                BlockWriter out{fast, 16};      // tiny block: exercises flushing
+                renderer.render(s, size, out);
+            }
+            std::ostringstream naive;
+            drawNaive(s, size, naive);
+            ok=ok && fast==naive.str();
+        }
+    }
+    std::cout<<"renderer matches the cout loops: "<<(ok ? "yes" : "NO")<<"\n";
+
+    // n = 5000 into /dev/null, so only the printing itself is measured
+    using Clock=std::chrono::steady_clock;
+    const int devNull{::open("/dev/null", O_WRONLY)};
+    if(devNull<0) return 0;
+    std::ofstream nullStream{"/dev/null"};
+    const long long big{5000};
+    std::cout<<std::fixed<<std::setprecision(1)<<"n = "<<big<<" into /dev/null:\n";
+    for(const Shape& s : kShapes){
+        auto t0{Clock::now()};
+        drawNaive(s, big, nullStream);
+        auto t1{Clock::now()};
+        {
+            BlockWriter out{devNull};
+            renderer.render(s, big, out);
+        }
+        auto t2{Clock::now()};
+        std::cout<<std::setw(20)<<s.name<<": cout loop "<<std::setw(7)
+                 <<std::chrono::duration<double, std::milli>{t1-t0}.count()<<" ms, renderer "<<std::setw(6)
+                 <<std::chrono::duration<double, std::milli>{t2-t1}.count()<<" ms\n";
+    }
+    ::close(devNull);
+    return 0;
+}
+/*
+🔸 Output (sample, 2 GHz VM)
+Shapes: 0.Square 1.LowerTriangle 2.UpperTriangle 3.Cross 4.CrossLowerTriangle 5.CrossUpperTriangle 6.NumberedGrid
+Enter shape number and size of square grid: 4 5
+        * 
+      * * 
+    * * * 
+  * * * * 
+* * * * * 
+renderer matches the cout loops: yes
+n = 5000 into /dev/null:
+              Square: cout loop   708.0 ms, renderer   74.9 ms
+       LowerTriangle: cout loop   418.2 ms, renderer   75.8 ms
+       UpperTriangle: cout loop   631.3 ms, renderer   74.4 ms
+               Cross: cout loop   654.1 ms, renderer   85.6 ms
+  CrossLowerTriangle: cout loop   713.5 ms, renderer   79.5 ms
+  CrossUpperTriangle: cout loop   392.2 ms, renderer   69.1 ms
+        NumberedGrid: cout loop  2129.1 ms, renderer  383.3 ms
+
+⚠️ Notes
+ - To a terminal the difference is smaller: there the terminal itself is
+   the bottleneck. Into files and pipes the flushing is what hurts.
+ - The renderer still asks the shape about every cell to find the runs;
+   that is now most of its time. Computing the runs of a row directly
+   from i and n is 39.ClosedFormPatternRows.cpp.
+ - 21.Cross-LowerTriangularStarPattern.cpp skips empty cells, so its
+   triangle comes out left-aligned, unlike the picture in its comment;
+   CrossLowerTriangle here prints the blanks (as CodingExercise40 does).
+ - Do not mix cout and raw write() without cout.flush() in between, or the
+   output comes out in the wrong order.
+*/
@@ -0,0 +1,368 @@
+/*
+📐 Pattern rows in closed form, rendered by several threads
+18.Lowertriangularstarpattern.cpp - 22.Cross-UpperTriangularStarPattern.cpp
+test a condition like if(i>=j) for EVERY cell of the n x n grid, even where
+nothing is printed; 38.BufferedPatternRenderer.cpp still asks the condition
+cell by cell to find the runs. But the runs of row i follow directly from
+i and n:
+    shape                 row i (cells; a cell is "* " or "  ")
+    Square                n stars
+    LowerTriangle         i+1 stars
+    UpperTriangle         i blanks, n-i stars
+    Cross                 a blanks, star, b-a-1 blanks, star, n-1-b blanks
+                          with a = min(i, n-1-i), b = max(i, n-1-i)  (one star if a==b)
+    CrossLowerTriangle    n-1-i blanks, i+1 stars
+    CrossUpperTriangle    n-i stars
+A row is then at most 5 memcpy/memset calls: the work is proportional to the
+characters printed, not to n*n cells.
+
+🔹 Where each row goes
+Every row length is known in advance (2 bytes per cell + '\n'; for the
+numbered grid the digit counts of the numbers in the row, also closed form),
+so a prefix sum gives the byte offset of every row in the output. Threads
+can then fill DISJOINT row ranges of one shared buffer with no locking, and
+the buffer goes out with a single write(). The rows are split so that every
+thread gets about the same number of BYTES (a triangle's last rows are much
+longer than its first).
+
+🔹 Slabs
+A 20000 x 20000 square is 800 MB of text. Rows are rendered in slabs of at
+most kSlabBytes, each slab filled in parallel and then written, so memory
+stays bounded for any n.
+*/
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <cerrno>
+#include <charconv>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <algorithm>
+#include <thread>
+#include <future>
+#include <chrono>
+#include <iomanip>
+#include <fcntl.h>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+constexpr std::size_t kSlabBytes{std::size_t{64}<<20};
+
+struct Run{
+    bool star;
+    long long cells;
+};
+
+struct RowRuns{
+    Run runs[5]{};
+    int count{};
+
+    void add(bool star, long long cells)
+    {
+        if(cells>0) runs[count++]={star, cells};
+    }
+};
+
+enum class RowKind{ Runs, Numbers };
+
+struct RowShape{
+    const char* name;
+    RowRuns (*row)(long long i, long long n);
+    RowKind kind;
+};
+
+constexpr RowShape kRowShapes[]{
+    {"Square", [](long long, long long n){ RowRuns r; r.add(true, n); return r; }, RowKind::Runs},
+    {"LowerTriangle", [](long long i, long long){ RowRuns r; r.add(true, i+1); return r; }, RowKind::Runs},
+    {"UpperTriangle", [](long long i, long long n){ RowRuns r; r.add(false, i); r.add(true, n-i); return r; }, RowKind::Runs},
+    {"Cross", [](long long i, long long n){
+        const long long a{std::min(i, n-1-i)}, b{std::max(i, n-1-i)};
+        RowRuns r;
+        r.add(false, a);
+        r.add(true, 1);
+        if(b>a){
+            r.add(false, b-a-1);
+            r.add(true, 1);
+        }
+        r.add(false, n-1-b);
+        return r;
+    }, RowKind::Runs},
+    {"CrossLowerTriangle", [](long long i, long long n){ RowRuns r; r.add(false, n-1-i); r.add(true, i+1); return r; }, RowKind::Runs},
+    {"CrossUpperTriangle", [](long long i, long long n){ RowRuns r; r.add(true, n-i); return r; }, RowKind::Runs},
+    {"NumberedGrid", nullptr, RowKind::Numbers},
+};
+
+namespace detail{
+
+// Total number of digits in 1, 2, ..., x
+inline std::uint64_t digitsUpTo(std::uint64_t x)
+{
+    std::uint64_t total{}, low{1};
+    for(std::uint64_t digits{1};low<=x;++digits){
+        const std::uint64_t high{low>std::numeric_limits<std::uint64_t>::max()/10 ? x : std::min(x, low*10-1)};
+        total+=(high-low+1)*digits;
+        if(high==x) break;
+        low*=10;
+    }
+    return total;
+}
+
+inline void writeAll(int fd, const char* p, std::size_t n)
+{
+    while(n>0){
+#if defined(_WIN32)
+        const int written{::_write(fd, p, static_cast<unsigned>(std::min<std::size_t>(n, 1u<<30)))};
+#else
+        const ssize_t written{::write(fd, p, n)};
+#endif
+        if(written<0){
+            if(errno==EINTR) continue;
+            throw std::system_error{errno, std::generic_category(), "write failed"};
+        }
+        p+=written;
+        n-=static_cast<std::size_t>(written);
+    }
+}
+
+}   // namespace detail
+
+class ClosedFormRenderer{
+public:
+    explicit ClosedFormRenderer(unsigned threads=std::max(1u, std::thread::hardware_concurrency()))
+        : threadCount{std::max(1u, threads)} {}
+
+    // Bytes of row i, including the '\n'.
+    static std::size_t rowBytes(const RowShape& shape, long long i, long long n)
+    {
+        if(shape.kind==RowKind::Numbers){
+            const std::uint64_t first{static_cast<std::uint64_t>(i)*static_cast<std::uint64_t>(n)};
+            const std::uint64_t last{first+static_cast<std::uint64_t>(n)};
+            return static_cast<std::size_t>(detail::digitsUpTo(last)-detail::digitsUpTo(first))+static_cast<std::size_t>(n)+1;
+        }
+        const RowRuns r{shape.row(i, n)};
+        std::size_t bytes{1};
+        for(int k{};k<r.count;++k) bytes+=2*static_cast<std::size_t>(r.runs[k].cells);
+        return bytes;
+    }
+
+    // Renders the pattern to fd (1 = stdout).
+    void render(const RowShape& shape, long long n, int fd)
+    {
+        renderSlabs(shape, n, [fd](const char* p, std::size_t bytes){ detail::writeAll(fd, p, bytes); });
+    }
+
+    std::string render_to_string(const RowShape& shape, long long n)
+    {
+        std::string out;
+        renderSlabs(shape, n, [&out](const char* p, std::size_t bytes){ out.append(p, bytes); });
+        return out;
+    }
+
+private:
+    template<class Sink>
+    void renderSlabs(const RowShape& shape, long long n, Sink sink)
+    {
+        if(n<=0) return;
+        if(shape.kind==RowKind::Runs && stars.size()<2*static_cast<std::size_t>(n)){
+            stars.resize(2*static_cast<std::size_t>(n));
+            for(std::size_t j{};j<stars.size();j+=2){
+                stars[j]='*';
+                stars[j+1]=' ';
+            }
+        }
+        // offsets[k] = byte offset of row first+k inside the current slab
+        std::vector<std::size_t> offsets;
+        for(long long first{};first<n;){
+            offsets.assign(1, 0);
+            long long last{first};
+            while(last<n){
+                const std::size_t bytes{rowBytes(shape, last, n)};
+                if(last>first && offsets.back()+bytes>kSlabBytes) break;
+                offsets.push_back(offsets.back()+bytes);
+                ++last;
+            }
+            const std::size_t total{offsets.back()};
+            if(slab.size()<total) slab.resize(total);
+            fillParallel(shape, n, first, last, offsets);
+            sink(slab.data(), total);
+            first=last;
+        }
+    }
+
+    void fillParallel(const RowShape& shape, long long n, long long first, long long last,
+                      const std::vector<std::size_t>& offsets)
+    {
+        const std::size_t total{offsets.back()};
+        const unsigned threads{total<(std::size_t{1}<<20) ? 1u : threadCount};
+        // thread t starts at the first row whose offset reaches t/threads of the bytes
+        std::vector<long long> bounds(threads+1, last);
+        bounds[0]=first;
+        for(unsigned t{1};t<threads;++t){
+            const std::size_t target{total/threads*t};
+            bounds[t]=first+(std::lower_bound(offsets.begin(), offsets.end()-1, target)-offsets.begin());
+        }
+        auto fill=[&](long long from, long long to){
+            for(long long i{from};i<to;++i){
+                fillRow(shape, i, n, slab.data()+offsets[static_cast<std::size_t>(i-first)]);
+            }
+        };
+        std::vector<std::future<void>> pending;
+        for(unsigned t{1};t<threads;++t){
+            if(bounds[t]<bounds[t+1]) pending.push_back(std::async(std::launch::async, fill, bounds[t], bounds[t+1]));
+        }
+        fill(bounds[0], bounds[1]);
+        for(std::future<void>& p : pending) p.get();
+    }
+
+    void fillRow(const RowShape& shape, long long i, long long n, char* out) const
+    {
+        if(shape.kind==RowKind::Numbers){
+            // to_chars once per row, then count up in the text itself:
+            // "129" → "130" touches 2 characters, no division
+            // The first number goes at the END of the buffer, so every carry
+            // (9 → 10, 99 → 100 ...) has room to grow to the left.
+            char first[20];
+            const char* const firstEnd{std::to_chars(first, first+sizeof(first),
+                                                     static_cast<std::uint64_t>(i)*static_cast<std::uint64_t>(n)+1).ptr};
+            char digits[20];
+            char* const end{digits+sizeof(digits)};
+            char* begin{end-(firstEnd-first)};
+            std::memcpy(begin, first, static_cast<std::size_t>(firstEnd-first));
+            for(long long j{};j<n;++j){
+                const std::size_t length{static_cast<std::size_t>(end-begin)};
+                std::memcpy(out, begin, length);
+                out[length]='\t';
+                out+=length+1;
+                char* d{end-1};
+                while(d>=begin && *d=='9') *d--='0';
+                if(d<begin) *--begin='1';       // 999 → 1000
+                else ++*d;
+            }
+            *out='\n';
+            return;
+        }
+        const RowRuns r{shape.row(i, n)};
+        for(int k{};k<r.count;++k){
+            const std::size_t bytes{2*static_cast<std::size_t>(r.runs[k].cells)};
+            if(r.runs[k].star) std::memcpy(out, stars.data(), bytes);
+            else std::memset(out, ' ', bytes);
+            out+=bytes;
+        }
+        *out='\n';
+    }
+
+    unsigned threadCount{};
+    std::string stars;
+    std::vector<char> slab;
+};
+
+// The cell-by-cell conditions of lessons 18-22 (empty cells as in 38), for the check.
+std::string drawNaive(std::size_t shape, long long n)
+{
+    std::ostringstream out;
+    long long count{1};
+    for(long long i{};i<n;++i){
+        for(long long j{};j<n;++j){
+            switch(shape){
+                case 0: out<<"* "; break;
+                case 1: if(i>=j) out<<"* "; break;
+                case 2: out<<(j>=i ? "* " : "  "); break;
+                case 3: out<<(i==j || i+j==n-1 ? "* " : "  "); break;
+                case 4: out<<(i+j>=n-1 ? "* " : "  "); break;
+                case 5: if(i+j<=n-1) out<<"* "; break;
+                default: out<<count++<<"\t"; break;
+            }
+        }
+        out<<"\n";
+    }
+    return out.str();
+}
+
+int main(){
+    std::cout<<"Shapes:";
+    for(std::size_t s{};s<std::size(kRowShapes);++s) std::cout<<" "<<s<<"."<<kRowShapes[s].name;
+    std::cout<<"\nEnter shape number and size of square grid: ";
+    std::size_t shape{};
+    long long n{};
+    std::cin>>shape>>n;
+    if(shape>=std::size(kRowShapes)){
+        std::cout<<"no such shape\n";
+        return 1;
+    }
+    std::cout.flush();
+    ClosedFormRenderer renderer;
+    renderer.render(kRowShapes[shape], n, 1);
+
+    bool ok{true};
+    for(std::size_t s{};s<std::size(kRowShapes);++s){
+        for(long long size{0};size<=120;++size){
+            ok=ok && renderer.render_to_string(kRowShapes[s], size)==drawNaive(s, size);
+        }
+    }
+    std::cout<<"closed form matches the cell loops: "<<(ok ? "yes" : "NO")<<"\n";
+
+    using Clock=std::chrono::steady_clock;
+    const int devNull{::open("/dev/null", O_WRONLY)};
+    if(devNull<0) return 0;
+    ClosedFormRenderer single{1};
+    single.render(kRowShapes[0], 5'000, devNull);      // touch the slab pages once
+    renderer.render(kRowShapes[0], 5'000, devNull);
+    std::cout<<std::fixed<<std::setprecision(1)<<"into /dev/null, "<<std::max(1u, std::thread::hardware_concurrency())
+             <<" threads:\n";
+    for(long long size : {5'000LL, 20'000LL}){
+        for(const RowShape& s : kRowShapes){
+            if(s.kind==RowKind::Numbers && size>5'000) continue;     // 3.6 GB of numbers
+            auto t0{Clock::now()};
+            single.render(s, size, devNull);
+            auto t1{Clock::now()};
+            renderer.render(s, size, devNull);
+            auto t2{Clock::now()};
+            std::cout<<std::setw(6)<<size<<std::setw(20)<<s.name<<": 1 thread "<<std::setw(7)
+                     <<std::chrono::duration<double, std::milli>{t1-t0}.count()<<" ms, all "<<std::setw(7)
+                     <<std::chrono::duration<double, std::milli>{t2-t1}.count()<<" ms\n";
+        }
+    }
+    ::close(devNull);
+    return 0;
+}
+/*
+🔸 Output (sample, 1-core 2 GHz VM)
+Shapes: 0.Square 1.LowerTriangle 2.UpperTriangle 3.Cross 4.CrossLowerTriangle 5.CrossUpperTriangle 6.NumberedGrid
+Enter shape number and size of square grid: 3 5
+*       * 
+  *   *   
+    *     
+  *   *   
+*       * 
+closed form matches the cell loops: yes
+into /dev/null, 1 threads:
+  5000              Square: 1 thread     6.4 ms, all     6.0 ms
+  5000       LowerTriangle: 1 thread     3.3 ms, all     3.2 ms
+  5000       UpperTriangle: 1 thread     6.5 ms, all     6.3 ms
+  5000               Cross: 1 thread     6.9 ms, all     6.6 ms
+  5000  CrossLowerTriangle: 1 thread     6.1 ms, all     6.5 ms
+  5000  CrossUpperTriangle: 1 thread     3.3 ms, all     3.2 ms
+  5000        NumberedGrid: 1 thread   318.2 ms, all   320.1 ms
+ 20000              Square: 1 thread    84.4 ms, all    84.2 ms
+ ...
+
+⚠️ Notes
+ - n = 5000 square: ~700 ms with cout per cell (23.SquareOfStar.cpp),
+   ~75 ms in 38.BufferedPatternRenderer.cpp, ~6 ms here. The triangles
+   take half the time of the square: they print half the characters.
+ - This machine has 1 core, so "all" cannot be faster here. With more
+   cores the fill scales until memory bandwidth (or the disk/pipe behind
+   write()) is the limit.
+ - The numbered grid is limited by producing 25 million numbers, not by
+   the grid; its rows only have a closed-form LENGTH.
+*/
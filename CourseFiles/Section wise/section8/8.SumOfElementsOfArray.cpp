@@ -41,3 +41,8 @@ int main()
 }
 
 */
+/*
+⚠️ An int sum overflows past 2^31-1, and the commented loop above has a typo:
+sum=sum=+a[i] assigns +a[i] instead of adding (should be sum=sum+a[i]).
+For long arrays and floats see 32.StableSumAverage.cpp.
+*/
@@ -101,3 +101,7 @@ for(int i = 1; i < 10; ++i) {
 
 
 
+/*
+⚠️ For big arrays (and float/double with NaN) see 31.MinMaxReduction.cpp:
+SIMD min/max/argmin/argmax, optional threads, explicit NaN handling.
+*/
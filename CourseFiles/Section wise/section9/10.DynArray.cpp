@@ -0,0 +1,467 @@
+/*
+📈 DynArray<T>: a heap array that grows cheaply
+6.HeapArrayResizing.cpp "resizes" with new int[size] + copy + delete[].
+Growing that way by ONE element per new value copies the whole array every
+time: n pushes cost 1 + 2 + ... + n ≈ n²/2 copies. 10^5 values already mean
+5*10^9 copied ints.
+
+🔹 Geometric growth
+DynArray keeps a CAPACITY larger than its size and doubles it when full:
+    capacity 4 → 8 → 16 → 32 ...
+Each element is copied on average less than once more (1 + 1/2 + 1/4 ...),
+so push_back is O(1) amortised. reserve(n) allocates once up front,
+shrink_to_fit() gives the unused tail back.
+
+🔹 Relocating elements
+When the buffer moves, the old elements go to the new one:
+ - trivially copyable T (int, double, plain structs): one memcpy
+ - other T: moved (or copied, if its move constructor may throw, so a
+   failed push_back leaves the array unchanged), then destroyed
+push_back(x) where x is an element of the array itself still works: the
+new element is built in the new buffer BEFORE the old one is released.
+
+🔹 mremap for very large buffers (Linux)
+From kMapBytes (1 MB) on, a buffer of trivially copyable T is taken
+directly from the OS with mmap. Growing it then calls mremap(), which
+extends the mapping in place or moves its PAGES to a new address by
+editing the page table: no byte is copied, whatever the size.
+*/
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <new>
+#include <cstring>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+template<class T>
+class DynArray{
+public:
+    using value_type=T;
+    using iterator=T*;
+    using const_iterator=const T*;
+
+    DynArray()=default;
+
+    explicit DynArray(std::size_t count)
+    {
+        build(count, [&](T* p){ std::uninitialized_value_construct_n(p, count); });
+    }
+
+    DynArray(std::initializer_list<T> values)
+    {
+        build(values.size(), [&](T* p){ std::uninitialized_copy(values.begin(), values.end(), p); });
+    }
+
+    DynArray(const DynArray& other)
+    {
+        build(other.count_, [&](T* p){ std::uninitialized_copy_n(other.elements, other.count_, p); });
+    }
+
+    DynArray(DynArray&& other) noexcept
+        : elements{std::exchange(other.elements, nullptr)}, count_{std::exchange(other.count_, 0)},
+          capacity_{std::exchange(other.capacity_, 0)}, mapped{std::exchange(other.mapped, false)} {}
+
+    DynArray& operator=(const DynArray& other)
+    {
+        if(this!=&other){
+            DynArray copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    DynArray& operator=(DynArray&& other) noexcept
+    {
+        DynArray moved{std::move(other)};
+        swap(moved);
+        return *this;
+    }
+
+    ~DynArray()
+    {
+        std::destroy_n(elements, count_);
+        release(elements, capacity_, mapped);
+    }
+
+    void swap(DynArray& other) noexcept
+    {
+        std::swap(elements, other.elements);
+        std::swap(count_, other.count_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(mapped, other.mapped);
+    }
+
+    std::size_t size() const { return count_; }
+    std::size_t capacity() const { return capacity_; }
+    bool empty() const { return count_==0; }
+    static constexpr std::size_t max_size() { return static_cast<std::size_t>(-1)/2/sizeof(T); }
+
+    T* data() { return elements; }
+    const T* data() const { return elements; }
+    T& operator[](std::size_t i) { return elements[i]; }
+    const T& operator[](std::size_t i) const { return elements[i]; }
+    T& at(std::size_t i)
+    {
+        check(i);
+        return elements[i];
+    }
+    const T& at(std::size_t i) const
+    {
+        check(i);
+        return elements[i];
+    }
+    T& front() { return elements[0]; }
+    T& back() { return elements[count_-1]; }
+
+    iterator begin() { return elements; }
+    iterator end() { return elements+count_; }
+    const_iterator begin() const { return elements; }
+    const_iterator end() const { return elements+count_; }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<class... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if(count_<capacity_){
+            T* p{std::construct_at(elements+count_, std::forward<Args>(args)...)};
+            ++count_;
+            return *p;
+        }
+        // args may refer to an element of this array: build the new element
+        // before the old buffer goes away
+        const std::size_t newCapacity{grownCapacity(count_+1)};
+        if(canRemap(newCapacity)){
+            const T value(std::forward<Args>(args)...);     // trivially copyable: cheap
+            remap(newCapacity);
+            std::construct_at(elements+count_, value);
+        }
+        else{
+            Buffer fresh{newCapacity};
+            std::construct_at(fresh.data+count_, std::forward<Args>(args)...);
+            try{
+                relocateInto(fresh);
+            }
+            catch(...){
+                std::destroy_at(fresh.data+count_);     // the array itself is unchanged
+                throw;
+            }
+        }
+        ++count_;
+        return elements[count_-1];
+    }
+
+    void pop_back()
+    {
+        --count_;
+        std::destroy_at(elements+count_);
+    }
+
+    void clear()
+    {
+        std::destroy_n(elements, count_);
+        count_=0;
+    }
+
+    void resize(std::size_t count)
+    {
+        if(count<count_){
+            std::destroy_n(elements+count, count_-count);
+        }
+        else if(count>count_){
+            if(count>capacity_) reallocate(grownCapacity(count));
+            std::uninitialized_value_construct_n(elements+count_, count-count_);
+        }
+        count_=count;
+    }
+
+    void reserve(std::size_t capacity)
+    {
+        if(capacity>max_size()) throw std::length_error("DynArray: too many elements");
+        if(capacity>capacity_) reallocate(capacity);
+    }
+
+    void shrink_to_fit()
+    {
+        if(count_==capacity_) return;
+        if(count_==0){
+            release(elements, capacity_, mapped);
+            elements=nullptr;
+            capacity_=0;
+            mapped=false;
+            return;
+        }
+        reallocate(count_);
+    }
+
+private:
+    static constexpr std::size_t kMapBytes{std::size_t{1}<<20};
+    static constexpr bool kRelocateByBytes{std::is_trivially_copyable_v<T>};
+
+    // Raw storage for capacity elements, released unless taken over.
+    struct Buffer{
+        explicit Buffer(std::size_t capacity) : capacity{capacity}, mapped{useMap(capacity)}
+        {
+            data=allocate(this->capacity, mapped);
+        }
+        Buffer(const Buffer&)=delete;
+        Buffer& operator=(const Buffer&)=delete;
+        ~Buffer() { if(data!=nullptr) release(data, capacity, mapped); }
+
+        T* data{};
+        std::size_t capacity{};
+        bool mapped{};
+    };
+
+    void check(std::size_t i) const
+    {
+        if(i>=count_) throw std::out_of_range("DynArray::at: index " + std::to_string(i) + " >= size " + std::to_string(count_));
+    }
+
+    std::size_t grownCapacity(std::size_t needed) const
+    {
+        if(needed>max_size()) throw std::length_error("DynArray: too many elements");
+        return std::max({needed, capacity_*2, std::size_t{4}});
+    }
+
+    static bool useMap([[maybe_unused]] std::size_t capacity)
+    {
+#if defined(__linux__)
+        return kRelocateByBytes && alignof(T)<=4096 && capacity*sizeof(T)>=kMapBytes;
+#else
+        return false;
+#endif
+    }
+
+    bool canRemap([[maybe_unused]] std::size_t capacity) const
+    {
+        return mapped && useMap(capacity);
+    }
+
+    static std::size_t pageBytes([[maybe_unused]] std::size_t bytes)
+    {
+#if defined(__linux__)
+        static const std::size_t page{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+        return (bytes+page-1)/page*page;
+#else
+        return bytes;
+#endif
+    }
+
+    // capacity may be raised to use the whole last page of a mapping
+    static T* allocate(std::size_t& capacity, bool map)
+    {
+#if defined(__linux__)
+        if(map){
+            const std::size_t bytes{pageBytes(capacity*sizeof(T))};
+            void* p{::mmap(nullptr, bytes, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0)};
+            if(p==MAP_FAILED) throw std::bad_alloc{};
+            capacity=bytes/sizeof(T);
+            return static_cast<T*>(p);
+        }
+#endif
+        (void)map;
+        return static_cast<T*>(::operator new(capacity*sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    static void release(T* p, std::size_t capacity, [[maybe_unused]] bool map)
+    {
+        if(p==nullptr) return;
+#if defined(__linux__)
+        if(map){
+            ::munmap(p, pageBytes(capacity*sizeof(T)));
+            return;
+        }
+#endif
+        ::operator delete(p, std::align_val_t{alignof(T)});
+    }
+
+    void remap([[maybe_unused]] std::size_t capacity)
+    {
+#if defined(__linux__)
+        const std::size_t oldBytes{pageBytes(capacity_*sizeof(T))};
+        const std::size_t newBytes{pageBytes(capacity*sizeof(T))};
+        void* p{::mremap(elements, oldBytes, newBytes, MREMAP_MAYMOVE)};
+        if(p==MAP_FAILED) throw std::bad_alloc{};
+        elements=static_cast<T*>(p);
+        capacity_=newBytes/sizeof(T);
+#endif
+    }
+
+    // Moves the elements into fresh and makes it the array's buffer.
+    void relocateInto(Buffer& fresh)
+    {
+        if constexpr(kRelocateByBytes){
+            if(count_>0) std::memcpy(fresh.data, elements, count_*sizeof(T));
+        }
+        else if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>){
+            std::uninitialized_move_n(elements, count_, fresh.data);
+            std::destroy_n(elements, count_);
+        }
+        else{
+            std::uninitialized_copy_n(elements, count_, fresh.data);    // may throw: nothing changed yet
+            std::destroy_n(elements, count_);
+        }
+        release(elements, capacity_, mapped);
+        elements=std::exchange(fresh.data, nullptr);
+        capacity_=fresh.capacity;
+        mapped=fresh.mapped;
+    }
+
+    // Constructor body: fill(p) constructs count elements in a new buffer,
+    // which the array adopts only once they all exist. If fill throws, the
+    // buffer is released (a throwing constructor never reaches ~DynArray).
+    template<class Fill>
+    void build(std::size_t count, Fill fill)
+    {
+        if(count==0) return;
+        if(count>max_size()) throw std::length_error("DynArray: too many elements");
+        Buffer fresh{count};
+        fill(fresh.data);
+        elements=std::exchange(fresh.data, nullptr);
+        capacity_=fresh.capacity;
+        mapped=fresh.mapped;
+        count_=count;
+    }
+
+    void reallocate(std::size_t capacity)
+    {
+        if(canRemap(capacity)){
+            remap(capacity);
+            return;
+        }
+        Buffer fresh{capacity};
+        relocateInto(fresh);
+    }
+
+    T* elements{};
+    std::size_t count_{};
+    std::size_t capacity_{};
+    bool mapped{};          // elements comes from mmap
+};
+
+// Not trivially copyable: DynArray has to move it element by element.
+struct Tracked{
+    int value{};
+    Tracked(int v=0) : value{v} {}
+    Tracked(const Tracked& other) : value{other.value} {}
+    Tracked(Tracked&& other) noexcept : value{other.value} {}
+    Tracked& operator=(const Tracked&)=default;
+    Tracked& operator=(Tracked&&)=default;
+};
+
+int main(){
+    DynArray<int> arr;
+    std::size_t size{};
+    std::cout<<"Enter the number of elements: ";
+    std::cin>>size;
+    std::cout<<"Enter "<<size<<" elements:\n";
+    for(std::size_t i{};i<size;++i){
+        int x{};
+        std::cin>>x;
+        arr.push_back(x);
+        std::cout<<"size "<<arr.size()<<", capacity "<<arr.capacity()<<"\n";
+    }
+    arr.shrink_to_fit();
+    std::cout<<"You entered:";
+    for(int x : arr) std::cout<<" "<<x;
+    std::cout<<"\nafter shrink_to_fit: capacity "<<arr.capacity()<<"\n";
+    if(!arr.empty()){
+        arr.push_back(arr[0]);              // an element of the array itself
+        std::cout<<"pushed arr[0] again: back() = "<<arr.back()<<"\n";
+    }
+
+    using Clock=std::chrono::steady_clock;
+    auto ms=[](auto run){
+        auto t0{Clock::now()};
+        run();
+        return std::chrono::duration<double, std::milli>{Clock::now()-t0}.count();
+    };
+    std::cout<<std::fixed<<std::setprecision(1);
+
+    // 6.HeapArrayResizing.cpp style: new array one larger + copy + delete[] per push
+    const int small{100'000};
+    const double naive{ms([&]{
+        int* a{nullptr};
+        for(int n{};n<small;++n){
+            int* bigger{new int[n+1]};
+            for(int i{};i<n;++i) bigger[i]=a[i];
+            bigger[n]=n;
+            delete[] a;
+            a=bigger;
+        }
+        delete[] a;
+    })};
+    const double grown{ms([&]{
+        DynArray<int> a;
+        for(int n{};n<small;++n) a.push_back(n);
+    })};
+    std::cout<<small<<" pushes: copy on every resize "<<naive<<" ms, DynArray "<<grown<<" ms\n";
+
+    std::cout<<"      pushes   DynArray<int>   +reserve   std::vector<int>   DynArray<Tracked>   (ms)\n";
+    for(int n : {1'000'000, 10'000'000, 100'000'000}){
+        const double dyn{ms([&]{
+            DynArray<int> a;
+            for(int i{};i<n;++i) a.push_back(i);
+            if(a[static_cast<std::size_t>(n-1)]!=n-1) std::cout<<"WRONG ";
+        })};
+        const double reserved{ms([&]{
+            DynArray<int> a;
+            a.reserve(static_cast<std::size_t>(n));
+            for(int i{};i<n;++i) a.push_back(i);
+        })};
+        const double vec{ms([&]{
+            std::vector<int> a;
+            for(int i{};i<n;++i) a.push_back(i);
+        })};
+        const double tracked{ms([&]{
+            DynArray<Tracked> a;
+            for(int i{};i<n;++i) a.push_back(Tracked{i});
+        })};
+        std::cout<<std::setw(12)<<n<<std::setw(16)<<dyn<<std::setw(11)<<reserved<<std::setw(19)<<vec
+                 <<std::setw(20)<<tracked<<"\n";
+    }
+    return 0;
+}
+/*
+🔸 Output (sample, 2 GHz VM)
+Enter the number of elements: 5
+Enter 5 elements:
+1 2 3 4 5
+size 1, capacity 4
+size 2, capacity 4
+size 3, capacity 4
+size 4, capacity 4
+size 5, capacity 8
+You entered: 1 2 3 4 5
+after shrink_to_fit: capacity 5
+pushed arr[0] again: back() = 1
+100000 pushes: copy on every resize 211.0 ms, DynArray 1.0 ms
+      pushes   DynArray<int>   +reserve   std::vector<int>   DynArray<Tracked>   (ms)
+     1000000             7.6        6.9                6.2                 7.2
+    10000000            80.8       83.7               98.1                93.3
+   100000000           764.3      753.6              937.1               881.0
+
+⚠️ Notes
+ - At 10^8 ints DynArray<int> without reserve is as fast as with it: each
+   doubling is an mremap, not a 400 MB copy. std::vector and
+   DynArray<Tracked> copy or move every element at every doubling.
+ - What is left is touching 400 MB of fresh pages (page faults); reserve
+   cannot avoid that.
+ - Pointers and references into the array become invalid when it grows,
+   exactly as with std::vector (even with mremap, the address may change).
+*/
@@ -0,0 +1,352 @@
+/*
+♻️ ObjectPool<T>: reuse same-sized objects instead of new/delete
+5.Dynamicallocationinheap.cpp explains the Chrome example: tabs are opened
+and closed all the time, each one with new and delete. When millions of
+objects of ONE type come and go every second (tabs, orders, tree nodes),
+every new/delete goes through the general-purpose allocator, which has to
+handle every size, and threads compete for it.
+
+🔹 Slabs
+The pool takes memory for many objects at once (a SLAB of slabSize nodes)
+and never gives it back while it lives. A released object's node goes on a
+FREE LIST; acquire() takes a node from that list and constructs the object
+in it with placement new:
+    T* p = ::new(node->storage) T(args...);   // no allocation
+    p->~T();                                  // release(): destroy only
+Only when the free list is empty is a new slab added (under a mutex: this
+is rare - once per slabSize objects).
+
+🔹 Lock-free free list (Treiber stack with a tag)
+The free list is a stack of nodes; each free node stores the index of the
+node below it. Its top is ONE 64-bit atomic:
+    [ tag : 32 bits | index of the top node : 32 bits ]
+pop:  read top, read top->next, compare_exchange(top, {tag+1, next})
+push: node->next = top,             compare_exchange(top, {tag+1, node})
+If another thread changed the top in between, the exchange fails and we
+retry. The tag solves the ABA problem: thread 1 reads top = A (next B) and
+stops; thread 2 pops A, pops B, pushes A back. The top is "A" again, but
+B is in use - without the tag thread 1's exchange would succeed and put B
+back on the list. With it, the tag has changed, so the exchange fails.
+Indexes instead of pointers keep tag and top in 64 bits, which every
+64-bit CPU can compare-and-swap in one instruction.
+
+🔹 Statistics
+acquired/released counts and the number of failed exchanges (a measure
+of contention) are kept in per-thread-slot counters on their own cache
+lines, so counting does not become a new point of contention; stats()
+adds them up.
+*/
+
+#include <iostream>
+#include <atomic>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <chrono>
+#include <iomanip>
+
+struct PoolStats{
+    std::uint64_t acquired;
+    std::uint64_t released;
+    std::uint64_t inUse;
+    std::uint64_t capacity;         // objects in all slabs
+    std::uint64_t slabs;
+    std::uint64_t casRetries;       // failed compare_exchange on the free list
+};
+
+template<class T>
+class ObjectPool{
+public:
+    struct Deleter{
+        ObjectPool* pool;
+        void operator()(T* p) const { pool->release(p); }
+    };
+    using Handle=std::unique_ptr<T, Deleter>;
+
+    // slabSize objects per slab, rounded up to a power of two.
+    explicit ObjectPool(std::size_t slabSize=1024)
+    {
+        if(slabSize==0 || slabSize>(std::size_t{1}<<24)) throw std::invalid_argument("ObjectPool: slabSize must be 1 .. 2^24");
+        while((std::size_t{1}<<slabShift)<slabSize) ++slabShift;
+    }
+
+    ObjectPool(const ObjectPool&)=delete;
+    ObjectPool& operator=(const ObjectPool&)=delete;
+
+    // Objects still acquired are NOT destroyed: release them first.
+    ~ObjectPool()
+    {
+        for(std::size_t s{};s<slabCount.load(std::memory_order_relaxed);++s){
+            Node* slab{slabs[s].load(std::memory_order_relaxed)};
+            std::destroy_n(slab, slabObjects());
+            ::operator delete(slab, std::align_val_t{alignof(Node)});
+        }
+    }
+
+    template<class... Args>
+    T* acquire(Args&&... args)
+    {
+        Node* node{pop()};
+        if(node==nullptr) node=grow();
+        try{
+            T* object{::new(static_cast<void*>(node->storage)) T(std::forward<Args>(args)...)};
+            counters().acquired.fetch_add(1, std::memory_order_relaxed);
+            return object;
+        }
+        catch(...){
+            push(node);             // constructor threw: the node goes back
+            throw;
+        }
+    }
+
+    template<class... Args>
+    Handle make(Args&&... args) { return Handle{acquire(std::forward<Args>(args)...), Deleter{this}}; }
+
+    void release(T* object)
+    {
+        if(object==nullptr) return;
+        object->~T();
+        push(reinterpret_cast<Node*>(reinterpret_cast<std::byte*>(object)-offsetof(Node, storage)));
+        counters().released.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    PoolStats stats() const
+    {
+        PoolStats s{};
+        for(const Counters& c : shards){
+            s.acquired+=c.acquired.load(std::memory_order_relaxed);
+            s.released+=c.released.load(std::memory_order_relaxed);
+            s.casRetries+=c.casRetries.load(std::memory_order_relaxed);
+        }
+        s.inUse=s.acquired-s.released;
+        s.slabs=slabCount.load(std::memory_order_relaxed);
+        s.capacity=s.slabs*slabObjects();
+        return s;
+    }
+
+private:
+    // The link lives next to the object, not inside it: a thread that lost
+    // the race in pop() may still read `next` while the winner constructs T.
+    struct Node{
+        std::atomic<std::uint32_t> next{kEmpty};
+        std::uint32_t index{};
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    struct alignas(64) Counters{
+        std::atomic<std::uint64_t> acquired{}, released{}, casRetries{};
+    };
+
+    static constexpr std::uint32_t kEmpty{0xFFFFFFFFu};
+    static constexpr std::size_t kMaxSlabs{4096};
+    static constexpr unsigned kShards{64};
+
+    static std::uint64_t pack(std::uint64_t tag, std::uint32_t index) { return tag<<32 | index; }
+    static std::uint32_t indexOf(std::uint64_t top) { return static_cast<std::uint32_t>(top); }
+    static std::uint64_t tagOf(std::uint64_t top) { return top>>32; }
+
+    std::size_t slabObjects() const { return std::size_t{1}<<slabShift; }
+
+    Node* nodeAt(std::uint32_t index) const
+    {
+        return slabs[index>>slabShift].load(std::memory_order_acquire)+(index&(slabObjects()-1));
+    }
+
+    Node* pop()
+    {
+        std::uint64_t top{head.load(std::memory_order_acquire)};
+        for(;;){
+            const std::uint32_t index{indexOf(top)};
+            if(index==kEmpty) return nullptr;
+            Node* node{nodeAt(index)};
+            const std::uint32_t next{node->next.load(std::memory_order_relaxed)};
+            if(head.compare_exchange_weak(top, pack(tagOf(top)+1, next),
+                                          std::memory_order_acquire, std::memory_order_acquire)) return node;
+            counters().casRetries.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Push the chain first -> ... -> last (already linked) in one exchange.
+    void push(Node* first, Node* last)
+    {
+        std::uint64_t top{head.load(std::memory_order_relaxed)};
+        for(;;){
+            last->next.store(indexOf(top), std::memory_order_relaxed);
+            if(head.compare_exchange_weak(top, pack(tagOf(top)+1, first->index),
+                                          std::memory_order_release, std::memory_order_relaxed)) return;
+            counters().casRetries.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void push(Node* node) { push(node, node); }
+
+    // Free list empty: add a slab, keep its first node, put the rest on the list.
+    Node* grow()
+    {
+        std::lock_guard lock{growMutex};
+        if(Node* node{pop()}) return node;      // another thread grew it meanwhile
+        const std::size_t s{slabCount.load(std::memory_order_relaxed)};
+        if(s==kMaxSlabs || (s+1)*slabObjects()>kEmpty) throw std::bad_alloc{};
+        const std::size_t count{slabObjects()};
+        auto* slab{static_cast<Node*>(::operator new(sizeof(Node)*count, std::align_val_t{alignof(Node)}))};
+        for(std::size_t i{};i<count;++i){
+            Node* node{::new(static_cast<void*>(slab+i)) Node{}};
+            node->index=static_cast<std::uint32_t>(s*count+i);
+            node->next.store(node->index+1, std::memory_order_relaxed);
+        }
+        slabs[s].store(slab, std::memory_order_release);
+        slabCount.store(s+1, std::memory_order_release);
+        if(count>1) push(slab+1, slab+count-1);
+        return slab;
+    }
+
+    // Each thread gets one of kShards counter blocks, handed out in turn.
+    Counters& counters()
+    {
+        static std::atomic<unsigned> nextShard{};
+        thread_local const unsigned shard{nextShard.fetch_add(1, std::memory_order_relaxed)%kShards};
+        return shards[shard];
+    }
+
+    alignas(64) std::atomic<std::uint64_t> head{pack(0, kEmpty)};
+    alignas(64) std::array<std::atomic<Node*>, kMaxSlabs> slabs{};
+    std::atomic<std::size_t> slabCount{};
+    std::mutex growMutex;
+    unsigned slabShift{};
+    std::array<Counters, kShards> shards{};
+};
+
+// A browser tab, as in 5.Dynamicallocationinheap.cpp
+struct Tab{
+    int id;
+    std::string url;
+    Tab(int id, std::string url) : id{id}, url{std::move(url)} {}
+};
+
+// Same-sized objects churned in the benchmark.
+struct Order{
+    long id;
+    double price;
+    int quantity;
+    char side;
+};
+
+void printStats(const PoolStats& s)
+{
+    std::cout<<"acquired "<<s.acquired<<", released "<<s.released<<", in use "<<s.inUse
+             <<", capacity "<<s.capacity<<" in "<<s.slabs<<" slab(s), CAS retries "<<s.casRetries<<"\n";
+}
+
+int main(){
+    int count{};
+    std::cout<<"How many tabs to open: ";
+    std::cin>>count;
+    if(count<0) count=0;
+
+    ObjectPool<Tab> tabs{8};
+    std::vector<Tab*> open;
+    for(int i{};i<count;++i) open.push_back(tabs.acquire(i, "page" + std::to_string(i)));
+    printStats(tabs.stats());
+    for(std::size_t i{};i<open.size();i+=2){    // close every other tab ...
+        tabs.release(open[i]);
+        open[i]=nullptr;
+    }
+    for(std::size_t i{};i<open.size();i+=2) open[i]=tabs.acquire(100+int(i), "new page");    // ... and open new ones
+    std::cout<<"closed and reopened every other tab: ";
+    printStats(tabs.stats());
+    for(Tab* t : open) tabs.release(t);
+    {
+        auto tab{tabs.make(7, "handle")};       // released by its destructor
+        std::cout<<"tab "<<tab->id<<" via Handle, ";
+    }
+    printStats(tabs.stats());
+
+    // Contention: every thread acquires a batch of kBatch orders, then
+    // releases them, until kTotal orders have been churned in all.
+    using Clock=std::chrono::steady_clock;
+    constexpr std::size_t kTotal{std::size_t{1}<<23}, kBatch{16};
+    auto run{[](int threads, auto&& churn){
+        std::vector<std::thread> workers;
+        const auto t0{Clock::now()};
+        for(int t{};t<threads;++t) workers.emplace_back(churn, kTotal/kBatch/threads);
+        for(auto& w : workers) w.join();
+        return double(kTotal)/std::chrono::duration<double, std::micro>{Clock::now()-t0}.count();    // Mops/s
+    }};
+
+    std::cout<<std::fixed<<std::setprecision(1)<<"churning "<<kTotal<<" orders, batches of "<<kBatch
+             <<" (million acquire+release per second):\n"
+             <<"threads   new/delete   ObjectPool   CAS retries\n";
+    for(int threads : {1, 2, 4, 8, 16, 32, 64}){
+        const double viaNew{run(threads, [](std::size_t rounds){
+            Order* batch[kBatch];
+            for(std::size_t r{};r<rounds;++r){
+                for(std::size_t i{};i<kBatch;++i) batch[i]=new Order{long(i), 1.5, 1, 'B'};
+                for(std::size_t i{};i<kBatch;++i){
+                    batch[i]->quantity+=1;
+                    delete batch[i];
+                }
+            }
+        })};
+        ObjectPool<Order> pool;
+        const double viaPool{run(threads, [&pool](std::size_t rounds){
+            Order* batch[kBatch];
+            for(std::size_t r{};r<rounds;++r){
+                for(std::size_t i{};i<kBatch;++i) batch[i]=pool.acquire(Order{long(i), 1.5, 1, 'B'});
+                for(std::size_t i{};i<kBatch;++i){
+                    batch[i]->quantity+=1;
+                    pool.release(batch[i]);
+                }
+            }
+        })};
+        const PoolStats s{pool.stats()};
+        if(s.inUse!=0) std::cout<<"pool lost objects!\n";
+        std::cout<<std::setw(7)<<threads<<std::setw(13)<<viaNew<<std::setw(13)<<viaPool<<std::setw(14)<<s.casRetries<<"\n";
+    }
+    std::cout<<"hardware threads here: "<<std::thread::hardware_concurrency()<<"\n";
+    return 0;
+}
+/*
+🔸 Output (sample, 2 GHz VM with ONE core)
+How many tabs to open: 6
+acquired 6, released 0, in use 6, capacity 8 in 1 slab(s), CAS retries 0
+closed and reopened every other tab: acquired 9, released 3, in use 6, capacity 8 in 1 slab(s), CAS retries 0
+tab 7 via Handle, acquired 10, released 10, in use 0, capacity 8 in 1 slab(s), CAS retries 0
+churning 8388608 orders, batches of 16 (million acquire+release per second):
+threads   new/delete   ObjectPool   CAS retries
+      1         24.3         23.1             0
+      2         30.7         24.4             6
+      4         29.0         24.8             6
+      8         31.2         24.2            12
+     16         22.5         23.7             7
+     32         22.1         23.4             9
+     64         23.6         23.7             7
+hardware threads here: 1
+
+⚠️ Notes
+ - With one core the threads only take turns, so they almost never meet
+   inside an exchange (a handful of retries): these numbers show the cost
+   of one acquire/release, not contention. On a multi-core machine the
+   retries column grows with the thread count; that is the number to watch.
+ - glibc's malloc keeps a small per-thread cache (tcache) for freed blocks
+   of each size, so for "free it on the thread that allocated it" it is as
+   fast as the pool here. The pool wins on other workloads: objects released
+   on a different thread than the one that acquired them, memory that must
+   stay in one place (no fragmentation with other sizes), and the
+   statistics. Measure the real workload before replacing new/delete.
+ - Every acquire and release is one compare_exchange on the same cache line
+   (the top of the list). If that line becomes the bottleneck, give each
+   thread a small cache of free nodes and exchange them with the shared
+   list in batches (push(first, last) already moves a whole chain at once).
+ - Release every object before the pool is destroyed, and only to the pool
+   it came from. ObjectPool<T>::Handle (make()) does that automatically.
+ - The node memory is never returned to the system while the pool lives:
+   its peak size is its size.
+*/
@@ -266,3 +266,9 @@ Program exits	                OS reclaims memory
 (But you can't reuse it)
 
 */
+
+/*
+⚡ Many small objects that all die together (one request, one frame)
+do not need a delete each: a bump-pointer arena hands them out and frees
+them all at once. See 11.ArenaAllocator.cpp.
+*/
@@ -91,3 +91,9 @@ You’ll get a compiler error with delete p[]; because it's not a valid statemen
  - So, you must use delete[] to properly deallocate all elements of that array.
  - If you use just delete p;, only the first element is destroyed causing memory leaks.
 */
+
+/*
+⚡ new int[5] and delete[] per array costs a trip to the general-purpose
+allocator each time. For many short-lived arrays, a std::pmr::vector on a
+monotonic arena is cheaper: see 11.ArenaAllocator.cpp.
+*/
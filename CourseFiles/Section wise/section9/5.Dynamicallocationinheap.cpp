@@ -120,3 +120,14 @@ as NULL)
 •Nullptr doesn’t mean 0.
 •0 cannot be used in its place. 
 */
+
+/*
+⚡ Thousands of tiny new/delete pairs with the same lifetime can come from
+one arena instead, released in O(1): see 11.ArenaAllocator.cpp.
+*/
+
+/*
+⚡ Opening and closing tabs again and again is the same-sized object over
+and over: a pool can hand back the memory of a closed tab to the next one
+without new/delete, also from several threads. See 12.ObjectPool.cpp.
+*/
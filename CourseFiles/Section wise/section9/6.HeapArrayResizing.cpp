@@ -136,3 +136,8 @@ int main() {
  - ✅ In heap, you can "resize" an array by allocating a new one.
  - ❌ You cannot do this with stack arrays.
 */
+/*
+⚡ Copying into a new array on EVERY resize makes n insertions cost O(n²).
+Growing the capacity geometrically (doubling), reserve/shrink_to_fit and
+mremap for huge buffers: see 10.DynArray.cpp.
+*/
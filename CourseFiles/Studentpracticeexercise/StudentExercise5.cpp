@@ -25,3 +25,7 @@ int main(){
         std::cout<<"Entered number is not a palindrome.\n";
     }
 }
+/*
+⚠️ int rev overflows for 10-digit inputs like 1000000009; see
+"Section wise/section7/30.DigitReversalTable.cpp" for a 64-bit, table based version.
+*/
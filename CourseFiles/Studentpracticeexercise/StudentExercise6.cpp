@@ -4,7 +4,7 @@ using namespace std;
 
 int main(){
  int n, i;
- float num[100], sum=0.0, average;
+ double num, sum=0.0, c=0.0, average;    // no array needed: add as we read
 
  cout << "Enter the numbers of elements: ";
  cin >> n;
@@ -12,8 +12,17 @@ int main(){
  for(i = 0; i < n; ++i)
  {
  cout << i + 1 << ". Enter number: ";
- cin >> num[i];
- sum += num[i];
+ cin >> num;
+ // Kahan summation: c keeps the rounding error of the previous addition
+ double y = num - c;
+ double t = sum + y;
+ c = (t - sum) - y;
+ sum = t;
+ }
+
+ if(n <= 0){
+ cout << "No numbers entered.";
+ return 0;
  }
 
  average = sum / n;
@@ -21,3 +30,8 @@ int main(){
 
  return 0;
 }
+/*
+⚠️ Earlier version stored at most 100 numbers in float num[100] and summed
+in a float (24-bit precision). See "Section wise/section8/32.StableSumAverage.cpp"
+for streaming mean/variance (RunningStats) and parallel sums.
+*/
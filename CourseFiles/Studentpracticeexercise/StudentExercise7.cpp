@@ -1,29 +1,40 @@
 //Program to Multiply Matrices
 #include <iostream>
+#include <vector>
 using namespace std;
 
 int main(){
-    int a[100][100]{}, b[100][100]{}, mult[100][100]{}, r1{}, c1{}, r2{}, c2{}, i{};
+    int r1{}, c1{}, r2{}, c2{}, i{};
     int j{}, k{};
 
     // Keep asking until valid dimensions are entered
     while (true) {
         cout << "Enter rows and columns for first matrix (r1 c1): ";
-        cin >> r1 >> c1;
+        if (!(cin >> r1 >> c1)) return 1;
         cout << "Enter rows and columns for second matrix (r2 c2): ";
-        cin >> r2 >> c2;
+        if (!(cin >> r2 >> c2)) return 1;
 
+        if (r1 <= 0 || c1 <= 0 || r2 <= 0 || c2 <= 0) {
+            cout << "Dimensions must be positive. Please try again.\n\n";
+            continue;
+        }
         if (c1 == r2) break; // Valid dimensions
 
         cout << "Matrix multiplication not possible (c1 != r2). Please try again.\n\n";
     }
 
+    // One contiguous heap block per matrix, sized from the input: element
+    // (i, j) of an r x c matrix is at [i*c + j]. (int a[100][100] three times
+    // was 120 KB of stack and capped the size at 100; see
+    // section8/37.Matrix2D.cpp for a full 2D array type.)
+    vector<int> a(r1 * c1), b(r2 * c2), mult(r1 * c2);
+
  // Storing elements of first matrix.
     cout << endl << "Enter elements of matrix 1:" << endl;
     for(i = 0; i < r1; ++i){
         for(j = 0; j < c1; ++j){
             cout << "Enter element a" << i + 1 << j + 1 << " : ";
-            cin >> a[i][j];
+            cin >> a[i * c1 + j];
          }
     }
 
@@ -32,17 +43,22 @@ int main(){
     for(i = 0; i < r2; ++i){
         for(j = 0; j < c2; ++j){
             cout << "Enter element b" << i + 1 << j + 1 << " : ";
-            cin >> b[i][j];
+            cin >> b[i * c2 + j];
         }
     }   
 
 
  // Multiplying matrix a and b and storing in array mult.
+    // i-k-j order: the inner loop walks along rows of b and mult instead of
+    // down a column of b (see section8/34.BlockedMatrixMultiplication.cpp)
     for(int i{};i<r1;++i){
         for(int j{};j<c2;++j){
-            mult[i][j]=0;
-            for(int k{};k<c1;++k){
-                mult[i][j]+=a[i][k]*b[k][j];
+            mult[i*c2+j]=0;
+        }
+        for(int k{};k<c1;++k){
+            const int aik{a[i*c1+k]};
+            for(int j{};j<c2;++j){
+                mult[i*c2+j]+=aik*b[k*c2+j];
             }
         }
     }
@@ -51,7 +67,7 @@ int main(){
     cout<<"Result matrix:\n";
     for(int i{};i<r1;++i){
         for(int j{};j<c2;++j){
-            cout<<mult[i][j]<<"\t";
+            cout<<mult[i*c2+j]<<"\t";
         }
         cout<<endl;
     }